@@ -0,0 +1,155 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/buffer_conversion.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Bulk conversion of raw device values (e.g. in mm, µs, kN or km/h)
+ * into buffers of base-unit quantities
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__buffer_conversion_h__
+#define __rrlib__si_units__buffer_conversion_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tQuantity.h"
+#include "rrlib/si_units/tConversionFactorCache.h"
+#include "rrlib/si_units/parallel_for.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Buffers with fewer elements are converted in the calling thread */
+const size_t cMINIMUM_PARALLEL_CONVERSION_SIZE = 1 << 16;
+
+namespace internal
+{
+
+/*!
+ * Scales count values into output.
+ * The main loop works on fixed blocks of 8 elements without aliasing, which
+ * compilers turn into SIMD code (including the widening of integer input)
+ * already at -O2. Multiplication happens in TValue for floating point output
+ * and in double otherwise.
+ */
+template <typename TSource, typename TValue>
+void ScaleKernel(const TSource *__restrict__ input, TValue *__restrict__ output, size_t count, double factor)
+{
+  typedef typename std::conditional<std::is_floating_point<TValue>::value, TValue, double>::type tCompute;
+  const tCompute compute_factor = static_cast<tCompute>(factor);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    tCompute block[8];
+    for (size_t k = 0; k < 8; ++k)
+    {
+      block[k] = static_cast<tCompute>(input[i + k]) * compute_factor;
+    }
+    for (size_t k = 0; k < 8; ++k)
+    {
+      output[i + k] = static_cast<TValue>(block[k]);
+    }
+  }
+  for (; i < count; ++i)
+  {
+    output[i] = static_cast<TValue>(static_cast<tCompute>(input[i]) * compute_factor);
+  }
+}
+
+}
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Converts raw values given in some unit into base-unit quantities by multiplying with factor.
+ * Large buffers are split across threads.
+ *
+ * \param factor Factor from the unit of input to the base unit
+ * \param input Raw input values
+ * \param output Output quantities (must not overlap input)
+ * \param count Number of values
+ * \param number_of_threads Maximum number of threads to use (0 for the number of hardware threads)
+ */
+template <typename TUnit, typename TSource, typename TValue>
+void ScaleBuffer(double factor, const TSource *input, tQuantity<TUnit, TValue> *output, size_t count, unsigned int number_of_threads = 0)
+{
+  static_assert(std::is_arithmetic<TSource>::value && std::is_arithmetic<TValue>::value, "Bulk conversion is only supported for arithmetic value types");
+  static_assert(sizeof(tQuantity<TUnit, TValue>) == sizeof(TValue) && std::is_standard_layout<tQuantity<TUnit, TValue>>::value, "tQuantity must have the layout of its value");
+
+  TValue *output_values = reinterpret_cast<TValue *>(output);
+  internal::ParallelFor(count, cMINIMUM_PARALLEL_CONVERSION_SIZE, [input, output_values, factor](size_t begin, size_t end)
+  {
+    internal::ScaleKernel(input + begin, output_values + begin, end - begin, factor);
+  }, number_of_threads);
+}
+
+/*!
+ * Converts raw values given in the unit denoted by source_symbol into base-unit quantities.
+ * The symbol is resolved once through GetCachedFactorToBaseUnit<TUnit>, which throws a std::runtime_error
+ * if it cannot be parsed.
+ *
+ * \param source_symbol Symbol of the unit of input (e.g. "mm" or "km/h")
+ * \param input Raw input values
+ * \param output Output quantities (must not overlap input)
+ * \param count Number of values
+ * \param number_of_threads Maximum number of threads to use (0 for the number of hardware threads)
+ */
+template <typename TUnit, typename TSource, typename TValue>
+void ConvertBuffer(const std::string &source_symbol, const TSource *input, tQuantity<TUnit, TValue> *output, size_t count, unsigned int number_of_threads = 0)
+{
+  ScaleBuffer(GetCachedFactorToBaseUnit<TUnit>(source_symbol), input, output, count, number_of_threads);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,303 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/column_parser.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <thread>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define RRLIB_SI_UNITS_USE_FROM_CHARS
+#endif
+#endif
+#endif
+
+#ifndef RRLIB_SI_UNITS_USE_FROM_CHARS
+#include <locale.h>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+// chunks smaller than this are not worth an own thread
+const size_t cMINIMUM_CHUNK_SIZE = 64 * 1024;
+
+// longer numbers are rejected instead of being truncated
+const size_t cMAX_PARSED_NUMBER_LENGTH = 63;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+//----------------------------------------------------------------------
+// ParseNumber
+//----------------------------------------------------------------------
+// Parses a number independent of LC_NUMERIC and returns the end of the number
+// (begin if there is none). Numbers longer than cMAX_PARSED_NUMBER_LENGTH may be
+// parsed only partially - the caller rejects them.
+const char *ParseNumber(const char *begin, const char *end, double &value, bool &out_of_range)
+{
+#ifdef RRLIB_SI_UNITS_USE_FROM_CHARS
+  // from_chars does not accept the leading plus sign that strtod does
+  const char *number_begin = (begin < end && *begin == '+') ? begin + 1 : begin;
+  if (number_begin < end && number_begin != begin && *number_begin == '-')
+  {
+    return begin;
+  }
+  std::from_chars_result result = std::from_chars(number_begin, end, value);
+  if (result.ptr == number_begin)
+  {
+    return begin;
+  }
+  out_of_range = result.ec == std::errc::result_out_of_range;
+  return result.ptr;
+#else
+  static const locale_t c_locale = newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+
+  // strtod needs a null-terminated string and the input is not
+  char buffer[cMAX_PARSED_NUMBER_LENGTH + 2];
+  size_t length = std::min<size_t>(end - begin, sizeof(buffer) - 1);
+  std::memcpy(buffer, begin, length);
+  buffer[length] = '\0';
+  char *number_end = nullptr;
+  errno = 0;
+  value = strtod_l(buffer, &number_end, c_locale);
+  out_of_range = errno == ERANGE && std::abs(value) == HUGE_VAL;
+  return begin + (number_end - buffer);
+#endif
+}
+
+//----------------------------------------------------------------------
+// NextLine
+//----------------------------------------------------------------------
+const char *NextLine(const char *position, const char *end)
+{
+  const char *newline = static_cast<const char *>(std::memchr(position, '\n', end - position));
+  return newline ? newline + 1 : end;
+}
+
+//----------------------------------------------------------------------
+// IsBlank
+//----------------------------------------------------------------------
+bool IsBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+//----------------------------------------------------------------------
+// CountRows
+//----------------------------------------------------------------------
+size_t CountRows(const char *begin, const char *end)
+{
+  size_t rows = std::count(begin, end, '\n');
+  return (begin != end && end[-1] != '\n') ? rows + 1 : rows;
+}
+
+}
+
+//----------------------------------------------------------------------
+// SplitIntoLineChunks
+//----------------------------------------------------------------------
+std::vector<tTextChunk> SplitIntoLineChunks(const char *data, size_t size, size_t header_lines, unsigned int number_of_chunks)
+{
+  const char *end = data + size;
+  const char *begin = data;
+  for (size_t i = 0; i < header_lines && begin < end; ++i)
+  {
+    begin = NextLine(begin, end);
+  }
+
+  if (number_of_chunks == 0)
+  {
+    number_of_chunks = std::max(1u, std::thread::hardware_concurrency());
+  }
+  size_t remaining = end - begin;
+  number_of_chunks = std::max<size_t>(1, std::min<size_t>(number_of_chunks, remaining / cMINIMUM_CHUNK_SIZE));
+
+  std::vector<tTextChunk> chunks;
+  const char *chunk_begin = begin;
+  for (size_t i = 1; i <= number_of_chunks && chunk_begin < end; ++i)
+  {
+    const char *chunk_end = (i == number_of_chunks) ? end : NextLine(std::max(chunk_begin, begin + i * (remaining / number_of_chunks)), end);
+    if (chunk_end > chunk_begin)
+    {
+      chunks.push_back(tTextChunk { chunk_begin, chunk_end, 0, 0 });
+    }
+    chunk_begin = chunk_end;
+  }
+
+  ParallelFor(chunks.size(), 1, [&chunks](size_t begin, size_t end)
+  {
+    for (size_t index = begin; index < end; ++index)
+    {
+      chunks[index].number_of_rows = CountRows(chunks[index].begin, chunks[index].end);
+    }
+  }, chunks.size(), 1);
+  for (size_t i = 1; i < chunks.size(); ++i)
+  {
+    chunks[i].first_row = chunks[i - 1].first_row + chunks[i - 1].number_of_rows;
+  }
+
+  return chunks;
+}
+
+//----------------------------------------------------------------------
+// ParseQuantityField
+//----------------------------------------------------------------------
+const char *ParseQuantityField(const char *line_begin, const char *line_end, size_t column, char delimiter, double &value, const char *&symbol_begin, const char *&symbol_end)
+{
+  const char *field_begin = line_begin;
+  for (size_t i = 0; i < column; ++i)
+  {
+    const char *next_delimiter = static_cast<const char *>(std::memchr(field_begin, delimiter, line_end - field_begin));
+    if (!next_delimiter)
+    {
+      return "Missing column";
+    }
+    field_begin = next_delimiter + 1;
+  }
+  const char *field_end = static_cast<const char *>(std::memchr(field_begin, delimiter, line_end - field_begin));
+  field_end = field_end ? field_end : line_end;
+
+  while (field_begin < field_end && IsBlank(*field_begin))
+  {
+    ++field_begin;
+  }
+  while (field_end > field_begin && IsBlank(field_end[-1]))
+  {
+    --field_end;
+  }
+  if (field_begin == field_end)
+  {
+    return "Empty field";
+  }
+
+  bool out_of_range = false;
+  const char *number_end = ParseNumber(field_begin, field_end, value, out_of_range);
+  if (number_end == field_begin)
+  {
+    return "Invalid number";
+  }
+  if (static_cast<size_t>(number_end - field_begin) > cMAX_PARSED_NUMBER_LENGTH)
+  {
+    return "Number too long";
+  }
+  if (out_of_range)
+  {
+    return "Number out of range";
+  }
+
+  symbol_begin = number_end;
+  while (symbol_begin < field_end && IsBlank(*symbol_begin))
+  {
+    ++symbol_begin;
+  }
+  symbol_end = field_end;
+  return nullptr;
+}
+
+//----------------------------------------------------------------------
+// tSymbolFactorCache Resolve
+//----------------------------------------------------------------------
+const char *tSymbolFactorCache::Resolve(const char *symbol_begin, const char *symbol_end, double &factor)
+{
+  size_t length = symbol_end - symbol_begin;
+  for (const tEntry & entry : this->entries)
+  {
+    if (entry.symbol.length() == length && std::memcmp(entry.symbol.data(), symbol_begin, length) == 0)
+    {
+      factor = entry.factor;
+      return entry.error_message.empty() ? nullptr : entry.error_message.c_str();
+    }
+  }
+
+  this->entries.push_back(tEntry { std::string(symbol_begin, symbol_end), 1, "" });
+  tEntry &entry = this->entries.back();
+  try
+  {
+    entry.factor = this->get_factor_to_base_unit(entry.symbol);
+  }
+  catch (const std::exception &exception)
+  {
+    entry.error_message = exception.what();
+  }
+  factor = entry.factor;
+  return entry.error_message.empty() ? nullptr : entry.error_message.c_str();
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,236 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/column_parser.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Bulk parsing of unit-annotated quantity columns (e.g. "12.5 mm") from
+ * CSV and text logs. The input is split into chunks on line boundaries
+ * that are parsed in parallel into a contiguous quantity buffer.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__column_parser_h__
+#define __rrlib__si_units__column_parser_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tQuantity.h"
+#include "rrlib/si_units/tConversionFactorCache.h"
+#include "rrlib/si_units/tMemoryMappedFile.h"
+#include "rrlib/si_units/parallel_for.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Error in a single row of parsed text (row is the index into the output buffer) */
+struct tParseError
+{
+  size_t row;
+  std::string message;
+};
+
+namespace internal
+{
+
+/*! Consecutive complete lines of a text buffer */
+struct tTextChunk
+{
+  const char *begin;
+  const char *end;
+  size_t first_row;
+  size_t number_of_rows;
+};
+
+/*!
+ * Splits a text buffer into chunks on line boundaries and counts the rows of each chunk.
+ *
+ * \param data Text buffer
+ * \param size Size of the text buffer
+ * \param header_lines Number of lines at the beginning that are skipped
+ * \param number_of_chunks Maximum number of chunks (0 for the number of hardware threads)
+ * \return The chunks in order of their appearance
+ */
+std::vector<tTextChunk> SplitIntoLineChunks(const char *data, size_t size, size_t header_lines, unsigned int number_of_chunks);
+
+/*!
+ * Extracts the numeric value and the symbol of a field in a line.
+ *
+ * \return nullptr on success, otherwise a static error message
+ */
+const char *ParseQuantityField(const char *line_begin, const char *line_end, size_t column, char delimiter, double &value, const char *&symbol_begin, const char *&symbol_end);
+
+/*!
+ * Resolves symbol strings to factors, calling the (slow) symbol parser only once per distinct symbol.
+ * Not thread-safe - use one instance per thread.
+ */
+class tSymbolFactorCache
+{
+public:
+
+  explicit tSymbolFactorCache(double(*get_factor_to_base_unit)(const std::string &))
+    : get_factor_to_base_unit(get_factor_to_base_unit)
+  {}
+
+  /*!
+   * \return nullptr on success, otherwise the error message of the symbol parser
+   */
+  const char *Resolve(const char *symbol_begin, const char *symbol_end, double &factor);
+
+private:
+
+  struct tEntry
+  {
+    std::string symbol;
+    double factor;
+    std::string error_message;
+  };
+
+  double(*get_factor_to_base_unit)(const std::string &);
+  std::vector<tEntry> entries;
+};
+
+}
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Parses one column of unit-annotated values from a text buffer.
+ * Rows that cannot be parsed are set to zero and reported in errors - no exceptions are thrown.
+ *
+ * \param data Text buffer (does not need to be null-terminated)
+ * \param size Size of the text buffer
+ * \param column Index of the column to parse
+ * \param values Filled with one quantity per row
+ * \param errors Filled with the errors of rows that could not be parsed (in row order)
+ * \param delimiter Column delimiter
+ * \param header_lines Number of lines at the beginning that are skipped
+ * \param number_of_threads Maximum number of threads to use (0 for the number of hardware threads)
+ * \return Whether all rows were parsed successfully
+ */
+template <typename TUnit, typename TValue>
+bool ParseQuantityColumn(const char *data, size_t size, size_t column, std::vector<tQuantity<TUnit, TValue>> &values, std::vector<tParseError> &errors,
+                         char delimiter = ',', size_t header_lines = 0, unsigned int number_of_threads = 0)
+{
+  std::vector<internal::tTextChunk> chunks = internal::SplitIntoLineChunks(data, size, header_lines, number_of_threads);
+  values.resize(chunks.empty() ? 0 : chunks.back().first_row + chunks.back().number_of_rows);
+  std::vector<std::vector<tParseError>> chunk_errors(chunks.size());
+
+  internal::ParallelFor(chunks.size(), 1, [&](size_t begin, size_t end)
+  {
+    for (size_t index = begin; index < end; ++index)
+    {
+      const internal::tTextChunk &chunk = chunks[index];
+      internal::tSymbolFactorCache symbol_factors(&GetCachedFactorToBaseUnit<TUnit>);
+      tQuantity<TUnit, TValue> *output = values.data() + chunk.first_row;
+      size_t row = chunk.first_row;
+      for (const char *line = chunk.begin; line < chunk.end; ++row, ++output)
+      {
+        const char *line_end = static_cast<const char *>(std::memchr(line, '\n', chunk.end - line));
+        line_end = line_end ? line_end : chunk.end;
+
+        double value = 0;
+        double factor = 1;
+        const char *symbol_begin = nullptr;
+        const char *symbol_end = nullptr;
+        const char *error_message = internal::ParseQuantityField(line, line_end, column, delimiter, value, symbol_begin, symbol_end);
+        if (!error_message && symbol_begin != symbol_end)
+        {
+          error_message = symbol_factors.Resolve(symbol_begin, symbol_end, factor);
+        }
+        if (error_message)
+        {
+          chunk_errors[index].push_back(tParseError { row, error_message });
+          *output = tQuantity<TUnit, TValue>();
+        }
+        else
+        {
+          *output = tQuantity<TUnit, TValue>(static_cast<TValue>(factor * value));
+        }
+
+        line = line_end + 1;
+      }
+    }
+  }, chunks.size(), 1);
+
+  errors.clear();
+  for (auto & chunk_error : chunk_errors)
+  {
+    errors.insert(errors.end(), chunk_error.begin(), chunk_error.end());
+  }
+  return errors.empty();
+}
+
+/*!
+ * Memory-maps a file and parses one column of unit-annotated values from it.
+ * If the file cannot be read, values is empty and errors contains one entry with row set to std::string::npos.
+ *
+ * \see ParseQuantityColumn(const char *, size_t, ...)
+ */
+template <typename TUnit, typename TValue>
+bool ParseQuantityColumn(const std::string &file_name, size_t column, std::vector<tQuantity<TUnit, TValue>> &values, std::vector<tParseError> &errors,
+                         char delimiter = ',', size_t header_lines = 0, unsigned int number_of_threads = 0)
+{
+  tMemoryMappedFile file(file_name);
+  if (!file.IsOpen())
+  {
+    values.clear();
+    errors.assign(1, tParseError { std::string::npos, file.ErrorMessage() });
+    return false;
+  }
+  return ParseQuantityColumn(file.Data(), file.Size(), column, values, errors, delimiter, header_lines, number_of_threads);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
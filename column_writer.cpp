@@ -0,0 +1,121 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/column_writer.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+// rows formatted per thread before the results are written
+const size_t cROWS_PER_THREAD_AND_SLICE = 1 << 18;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// WriteRows
+//----------------------------------------------------------------------
+void WriteRows(std::ostream &stream, const std::string &header, size_t rows, const std::function<void(size_t begin, size_t end, std::string &output)> &format_rows, unsigned int number_of_threads)
+{
+  stream << header << '\n';
+
+  if (number_of_threads == 0)
+  {
+    number_of_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  const size_t slice_size = number_of_threads * cROWS_PER_THREAD_AND_SLICE;
+
+  std::mutex mutex;
+  std::vector<std::pair<size_t, std::string>> blocks;
+  for (size_t slice_begin = 0; slice_begin < rows && stream; slice_begin += slice_size)
+  {
+    blocks.clear();
+    ParallelFor(std::min(slice_size, rows - slice_begin), cMINIMUM_PARALLEL_WRITE_SIZE, [&](size_t begin, size_t end)
+    {
+      std::string output;
+      format_rows(slice_begin + begin, slice_begin + end, output);
+      std::lock_guard<std::mutex> lock(mutex);
+      blocks.emplace_back(begin, std::move(output));
+    }, number_of_threads);
+
+    std::sort(blocks.begin(), blocks.end(), [](const std::pair<size_t, std::string> &a, const std::pair<size_t, std::string> &b)
+    {
+      return a.first < b.first;
+    });
+    for (auto & block : blocks)
+    {
+      stream.write(block.second.data(), block.second.size());
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,164 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/column_writer.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Bulk export of quantity series to CSV and text. The unit symbol is
+ * written once per column header (e.g. "force_x [N]") and the rows only
+ * contain plain numbers, which are formatted in parallel into large
+ * buffers and written in order.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__column_writer_h__
+#define __rrlib__si_units__column_writer_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <functional>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tQuantity.h"
+#include "rrlib/si_units/tQuantityFrame.h"
+#include "rrlib/si_units/tQuantityOperations.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Rows are formatted in blocks of at least this size per thread */
+const size_t cMINIMUM_PARALLEL_WRITE_SIZE = 1 << 14;
+
+namespace internal
+{
+
+/*!
+ * \return name followed by the unit symbol in brackets (just name for dimensionless units)
+ */
+template <typename TUnit>
+std::string ColumnHeader(const std::string &name)
+{
+  std::stringstream symbol;
+  symbol << TUnit();
+  return symbol.str().empty() ? name : name + " [" + symbol.str() + "]";
+}
+
+/*!
+ * Writes header and rows lines to stream.
+ * format_rows appends the text of rows [begin, end) to output and is called concurrently for
+ * consecutive blocks. The rows are processed in bounded slices, so memory use does not grow
+ * with the number of rows.
+ */
+void WriteRows(std::ostream &stream, const std::string &header, size_t rows, const std::function<void(size_t begin, size_t end, std::string &output)> &format_rows, unsigned int number_of_threads);
+
+}
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Writes one column of quantities (one value per line) below a header with the unit symbol.
+ * Errors are reported through the state of stream.
+ *
+ * \param stream Output stream
+ * \param name Column name used in the header
+ * \param values Quantities to write
+ * \param count Number of quantities
+ * \param number_of_threads Maximum number of threads to use (0 for the number of hardware threads)
+ */
+template <typename TUnit, typename TValue>
+void WriteQuantityColumn(std::ostream &stream, const std::string &name, const tQuantity<TUnit, TValue> *values, size_t count, unsigned int number_of_threads = 0)
+{
+  internal::WriteRows(stream, internal::ColumnHeader<TUnit>(name), count, [values](size_t begin, size_t end, std::string & output)
+  {
+    output.resize((end - begin) * (internal::cMAX_NUMBER_LENGTH + 1));
+    char *position = &output[0];
+    for (size_t row = begin; row < end; ++row)
+    {
+      position = internal::FormatValue(position, values[row].Value());
+      *position++ = '\n';
+    }
+    output.resize(position - output.data());
+  }, number_of_threads);
+}
+
+/*!
+ * Writes a frame as delimiter-separated columns in schema order with a header of
+ * field names and unit symbols. Errors are reported through the state of stream.
+ *
+ * \param stream Output stream
+ * \param frame Frame to write
+ * \param delimiter Column delimiter
+ * \param number_of_threads Maximum number of threads to use (0 for the number of hardware threads)
+ */
+template <typename ... TFields>
+void WriteQuantityFrame(std::ostream &stream, const tQuantityFrame<TFields...> &frame, char delimiter = ',', unsigned int number_of_threads = 0)
+{
+  std::string header;
+  int expand_header[] = { (header += internal::ColumnHeader<typename TFields::tQuantityType::tUnit>(TFields::Name()) + delimiter, 0)... };
+  (void)expand_header;
+  header.pop_back();
+
+  internal::WriteRows(stream, header, frame.Size(), [&frame, delimiter](size_t begin, size_t end, std::string & output)
+  {
+    output.resize((end - begin) * sizeof...(TFields) * (internal::cMAX_NUMBER_LENGTH + 1));
+    char *position = &output[0];
+    for (size_t row = begin; row < end; ++row)
+    {
+      int expand_row[] = { (position = internal::FormatValue(position, frame.template Column<TFields>()[row].Value()), *position++ = delimiter, 0)... };
+      (void)expand_row;
+      position[-1] = '\n';
+    }
+    output.resize(position - output.data());
+  }, number_of_threads);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,344 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/compile_time_symbols.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Derives tSIUnit types and scale factors from symbol expressions at
+ * compile time (requires C++20 class-type template parameters):
+ *
+ *   tUnitOf<"kg*m/s^2">              is tSIUnit<1, 1, -2, 0, 0, 0, 0>
+ *   tQuantityOf<"N/mm^2", float>     is tQuantity<tUnitOf<"N/mm^2">, float>
+ *   cFACTOR_OF<"N/mm^2">             is 1E6 (factor to the base unit)
+ *   QuantityFrom<"km/h">(36.0)       is tVelocity<>(10)
+ *
+ * Expressions are products of unit symbols (with optional SI prefix and
+ * integer exponent '^n') joined by '*' and '/'. A '/' only applies to the
+ * symbol directly following it, as in "kg*m/s^2" or "m/s/s". Invalid
+ * expressions are rejected during compilation.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__compile_time_symbols_h__
+#define __rrlib__si_units__compile_time_symbols_h__
+
+#if __cplusplus >= 202002L && defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tSIUnit.h"
+#include "rrlib/si_units/tQuantity.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*! String literal usable as template argument */
+template <size_t Tsize>
+struct tSymbolString
+{
+  char value[Tsize];
+
+  constexpr tSymbolString(const char(&string)[Tsize])
+  {
+    for (size_t i = 0; i < Tsize; ++i)
+    {
+      this->value[i] = string[i];
+    }
+  }
+
+  constexpr size_t Length() const
+  {
+    return Tsize - 1;
+  }
+};
+
+/*! Result of parsing a symbol expression */
+struct tSymbolExpression
+{
+  int exponents[cNUMBER_OF_BASIC_DIMENSIONS] = {};
+  double factor = 1;
+};
+
+/*! Unit symbol known to the compile-time parser */
+struct tCompileTimeSymbol
+{
+  const char *symbol;
+  int exponents[cNUMBER_OF_BASIC_DIMENSIONS];
+  double factor;
+  bool prefixable;
+};
+
+constexpr tCompileTimeSymbol cCOMPILE_TIME_SYMBOLS[] =
+{
+  { "m", { 1, 0, 0, 0, 0, 0, 0 }, 1, true },
+  { "g", { 0, 1, 0, 0, 0, 0, 0 }, 1E-3, true },
+  { "s", { 0, 0, 1, 0, 0, 0, 0 }, 1, true },
+  { "A", { 0, 0, 0, 1, 0, 0, 0 }, 1, true },
+  { "K", { 0, 0, 0, 0, 1, 0, 0 }, 1, true },
+  { "mol", { 0, 0, 0, 0, 0, 1, 0 }, 1, true },
+  { "cd", { 0, 0, 0, 0, 0, 0, 1 }, 1, true },
+  { "Hz", { 0, 0, -1, 0, 0, 0, 0 }, 1, true },
+  { "N", { 1, 1, -2, 0, 0, 0, 0 }, 1, true },
+  { "Pa", { -1, 1, -2, 0, 0, 0, 0 }, 1, true },
+  { "J", { 2, 1, -2, 0, 0, 0, 0 }, 1, true },
+  { "W", { 2, 1, -3, 0, 0, 0, 0 }, 1, true },
+  { "C", { 0, 0, 1, 1, 0, 0, 0 }, 1, true },
+  { "V", { 2, 1, -3, -1, 0, 0, 0 }, 1, true },
+  { "F", { -2, -1, 4, 2, 0, 0, 0 }, 1, true },
+  { "Ohm", { 2, 1, -3, -2, 0, 0, 0 }, 1, true },
+  { "Ω", { 2, 1, -3, -2, 0, 0, 0 }, 1, true },
+  { "Wb", { 2, 1, -2, -1, 0, 0, 0 }, 1, true },
+  { "T", { 0, 1, -2, -1, 0, 0, 0 }, 1, true },
+  { "bar", { -1, 1, -2, 0, 0, 0, 0 }, 1E5, true },
+  { "t", { 0, 1, 0, 0, 0, 0, 0 }, 1E3, false },
+  { "min", { 0, 0, 1, 0, 0, 0, 0 }, 60, false },
+  { "h", { 0, 0, 1, 0, 0, 0, 0 }, 3600, false }
+};
+
+/*! SI prefixes as accepted by the runtime symbol parser (plus "u" and "da") */
+struct tCompileTimePrefix
+{
+  const char *prefix;
+  double factor;
+};
+
+constexpr tCompileTimePrefix cCOMPILE_TIME_PREFIXES[] =
+{
+  { "y", 1E-24 }, { "z", 1E-21 }, { "a", 1E-18 }, { "f", 1E-15 }, { "p", 1E-12 }, { "n", 1E-9 },
+  { "µ", 1E-6 }, { "mc", 1E-6 }, { "u", 1E-6 }, { "m", 1E-3 }, { "c", 1E-2 }, { "d", 1E-1 },
+  { "da", 1E+1 }, { "D", 1E+1 }, { "h", 1E+2 }, { "k", 1E+3 }, { "M", 1E+6 }, { "G", 1E+9 },
+  { "T", 1E+12 }, { "P", 1E+15 }, { "E", 1E+18 }, { "Z", 1E+21 }, { "Y", 1E+24 }
+};
+
+constexpr bool IsSymbolCharacter(char c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || static_cast<unsigned char>(c) >= 0x80;
+}
+
+constexpr bool Equals(const char *begin, const char *end, const char *string)
+{
+  for (; begin < end && *string; ++begin, ++string)
+  {
+    if (*begin != *string)
+    {
+      return false;
+    }
+  }
+  return begin == end && !*string;
+}
+
+constexpr bool StartsWith(const char *begin, const char *end, const char *string)
+{
+  for (; *string; ++begin, ++string)
+  {
+    if (begin == end || *begin != *string)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*!
+ * Finds the unit of a symbol token, exact symbols taking precedence over prefixed ones
+ * (so "min" is minutes, "mm" millimeters and "Pa" pascal)
+ */
+constexpr const tCompileTimeSymbol &LookUpSymbol(const char *begin, const char *end, double &prefix_factor)
+{
+  for (const tCompileTimeSymbol & symbol : cCOMPILE_TIME_SYMBOLS)
+  {
+    if (Equals(begin, end, symbol.symbol))
+    {
+      prefix_factor = 1;
+      return symbol;
+    }
+  }
+  for (const tCompileTimePrefix & prefix : cCOMPILE_TIME_PREFIXES)
+  {
+    if (StartsWith(begin, end, prefix.prefix))
+    {
+      const char *rest = begin;
+      for (const char *p = prefix.prefix; *p; ++p)
+      {
+        ++rest;
+      }
+      for (const tCompileTimeSymbol & symbol : cCOMPILE_TIME_SYMBOLS)
+      {
+        if (symbol.prefixable && Equals(rest, end, symbol.symbol))
+        {
+          prefix_factor = prefix.factor;
+          return symbol;
+        }
+      }
+    }
+  }
+  throw std::invalid_argument("Unknown unit symbol in symbol expression");
+}
+
+constexpr tSymbolExpression ParseSymbolExpression(const char *begin, const char *end)
+{
+  tSymbolExpression result;
+  int sign = 1;
+  bool expect_symbol = true;
+  for (const char *position = begin; position < end;)
+  {
+    const char c = *position;
+    if (c == ' ')
+    {
+      ++position;
+    }
+    else if (c == '*' || c == '/')
+    {
+      if (expect_symbol)
+      {
+        throw std::invalid_argument("Missing unit symbol in symbol expression");
+      }
+      sign = c == '/' ? -1 : 1;
+      expect_symbol = true;
+      ++position;
+    }
+    else if (expect_symbol && c == '1')
+    {
+      expect_symbol = false;
+      ++position;
+    }
+    else if (expect_symbol && IsSymbolCharacter(c))
+    {
+      const char *token_end = position;
+      while (token_end < end && IsSymbolCharacter(*token_end))
+      {
+        ++token_end;
+      }
+      double factor = 1;
+      const tCompileTimeSymbol &symbol = LookUpSymbol(position, token_end, factor);
+      factor *= symbol.factor;
+      position = token_end;
+
+      int exponent = 1;
+      if (position < end && *position == '^')
+      {
+        ++position;
+        const bool negative = position < end && *position == '-';
+        position += negative ? 1 : 0;
+        if (position == end || *position < '0' || *position > '9')
+        {
+          throw std::invalid_argument("Missing exponent in symbol expression");
+        }
+        exponent = 0;
+        for (; position < end && *position >= '0' && *position <= '9'; ++position)
+        {
+          exponent = 10 * exponent + (*position - '0');
+        }
+        exponent = negative ? -exponent : exponent;
+      }
+      exponent *= sign;
+
+      for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
+      {
+        result.exponents[i] += exponent * symbol.exponents[i];
+      }
+      for (int i = 0; i < (exponent < 0 ? -exponent : exponent); ++i)
+      {
+        result.factor = exponent < 0 ? result.factor / factor : result.factor * factor;
+      }
+      expect_symbol = false;
+    }
+    else
+    {
+      throw std::invalid_argument("Unexpected character in symbol expression");
+    }
+  }
+  if (expect_symbol)
+  {
+    throw std::invalid_argument("Missing unit symbol in symbol expression");
+  }
+  return result;
+}
+
+template <tSymbolString Tsymbol>
+struct tParsedSymbol
+{
+  static constexpr tSymbolExpression cEXPRESSION = ParseSymbolExpression(Tsymbol.value, Tsymbol.value + Tsymbol.Length());
+  typedef tSIUnit<cEXPRESSION.exponents[0], cEXPRESSION.exponents[1], cEXPRESSION.exponents[2], cEXPRESSION.exponents[3], cEXPRESSION.exponents[4], cEXPRESSION.exponents[5], cEXPRESSION.exponents[6]> tUnit;
+};
+
+}
+
+/*! Unit type of a symbol expression (e.g. tUnitOf<"kg*m/s^2">) */
+template <internal::tSymbolString Tsymbol>
+using tUnitOf = typename internal::tParsedSymbol<Tsymbol>::tUnit;
+
+/*! Quantity type of a symbol expression (e.g. tQuantityOf<"N/mm^2", float>) */
+template <internal::tSymbolString Tsymbol, typename TValue = double>
+using tQuantityOf = tQuantity<tUnitOf<Tsymbol>, TValue>;
+
+/*! Factor from a symbol expression to its base unit (e.g. 1E6 for "N/mm^2") */
+template <internal::tSymbolString Tsymbol>
+constexpr double cFACTOR_OF = internal::tParsedSymbol<Tsymbol>::cEXPRESSION.factor;
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * \return A base-unit quantity for value given in the unit of a symbol expression
+ */
+template <internal::tSymbolString Tsymbol, typename TValue>
+constexpr tQuantityOf<Tsymbol, TValue> QuantityFrom(TValue value)
+{
+  return tQuantityOf<Tsymbol, TValue>(static_cast<TValue>(value * cFACTOR_OF<Tsymbol>));
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#endif
+
+#endif
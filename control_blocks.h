@@ -0,0 +1,535 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/control_blocks.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Unit-typed numerical blocks for fixed-step control loops: integrators
+ * (explicit Euler, semi-implicit Euler, RK4), first- and second-order
+ * IIR filters and a finite-difference derivative.
+ *
+ * Every block processes Tchannels channels per call. The state lives in
+ * fixed-size member arrays, so the blocks never allocate, lock or throw
+ * and can be used in real-time loops. The loops over the channels have
+ * a compile-time trip count and are vectorized by the compiler.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__control_blocks_h__
+#define __rrlib__si_units__control_blocks_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tQuantity.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Explicit Euler integrator
+/*!
+ * state += input * dt, e.g. integrating tAcceleration yields tVelocity
+ */
+template <typename TUnit, size_t Tchannels = 1, typename TValue = double>
+class tEulerIntegrator
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tQuantity<TUnit, TValue> tInput;
+  typedef tQuantity<typename operators::tProduct<TUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tResult, TValue> tOutput;
+  typedef tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> tTimeStep;
+
+  explicit tEulerIntegrator(tOutput initial_state = tOutput())
+  {
+    this->Reset(initial_state);
+  }
+
+  inline void Reset(tOutput value)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->state[i] = value;
+    }
+  }
+
+  inline void Reset(const tOutput *values)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->state[i] = values[i];
+    }
+  }
+
+  /*!
+   * \param input Tchannels input values
+   * \param dt Time step
+   * \return The Tchannels integrated values
+   */
+  inline const tOutput *Update(const tInput *input, tTimeStep dt)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->state[i] += input[i] * dt;
+    }
+    return this->state;
+  }
+
+  inline const tOutput *State() const
+  {
+    return this->state;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tOutput state[Tchannels];
+
+};
+
+//! Semi-implicit (symplectic) Euler integrator for second-order systems
+/*!
+ * Integrates the second derivative (e.g. tAcceleration) twice:
+ * first velocity += acceleration * dt, then position += velocity * dt with the new velocity.
+ * Unlike two explicit Euler steps this keeps the energy of oscillating systems bounded.
+ */
+template <typename TUnit, size_t Tchannels = 1, typename TValue = double>
+class tSemiImplicitEulerIntegrator
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tQuantity<TUnit, TValue> tInput;
+  typedef tQuantity<typename operators::tProduct<TUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tResult, TValue> tFirstIntegral;
+  typedef tQuantity<typename operators::tProduct<typename tFirstIntegral::tUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tResult, TValue> tOutput;
+  typedef tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> tTimeStep;
+
+  explicit tSemiImplicitEulerIntegrator(tOutput initial_state = tOutput(), tFirstIntegral initial_first_integral = tFirstIntegral())
+  {
+    this->Reset(initial_state, initial_first_integral);
+  }
+
+  inline void Reset(tOutput value, tFirstIntegral first_integral_value = tFirstIntegral())
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->state[i] = value;
+      this->first_integral[i] = first_integral_value;
+    }
+  }
+
+  /*!
+   * \param input Tchannels values of the second derivative
+   * \param dt Time step
+   * \return The Tchannels integrated values
+   */
+  inline const tOutput *Update(const tInput *input, tTimeStep dt)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->first_integral[i] += input[i] * dt;
+      this->state[i] += this->first_integral[i] * dt;
+    }
+    return this->state;
+  }
+
+  inline const tOutput *State() const
+  {
+    return this->state;
+  }
+
+  inline const tFirstIntegral *FirstIntegral() const
+  {
+    return this->first_integral;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tOutput state[Tchannels];
+  tFirstIntegral first_integral[Tchannels];
+
+};
+
+//! Classic fourth-order Runge-Kutta integrator
+/*!
+ * Integrates d(state)/dt = f(t, state) where state has unit TUnit.
+ * f is any callable with the signature
+ *   void f(tTimeStep t, const tState *state, tStateDerivative *derivative)
+ * that fills Tchannels derivatives. It is passed as template argument,
+ * so no std::function (and no allocation) is involved.
+ */
+template <typename TUnit, size_t Tchannels = 1, typename TValue = double>
+class tRK4Integrator
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tQuantity<TUnit, TValue> tState;
+  typedef tQuantity<typename operators::tQuotient<TUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tResult, TValue> tStateDerivative;
+  typedef tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> tTimeStep;
+
+  explicit tRK4Integrator(tState initial_state = tState())
+  {
+    this->Reset(initial_state);
+  }
+
+  inline void Reset(tState value)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->state[i] = value;
+    }
+  }
+
+  inline void Reset(const tState *values)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->state[i] = values[i];
+    }
+  }
+
+  /*!
+   * \param function Right-hand side f(t, state, derivative)
+   * \param t Time at the beginning of the step
+   * \param dt Time step
+   * \return The Tchannels states at t + dt
+   */
+  template <typename TFunction>
+  const tState *Update(TFunction &&function, tTimeStep t, tTimeStep dt)
+  {
+    tStateDerivative k1[Tchannels], k2[Tchannels], k3[Tchannels], k4[Tchannels];
+    tState intermediate[Tchannels];
+    const tTimeStep half_dt = dt * TValue(0.5);
+
+    function(t, this->state, k1);
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      intermediate[i] = this->state[i] + k1[i] * half_dt;
+    }
+    function(t + half_dt, intermediate, k2);
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      intermediate[i] = this->state[i] + k2[i] * half_dt;
+    }
+    function(t + half_dt, intermediate, k3);
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      intermediate[i] = this->state[i] + k3[i] * dt;
+    }
+    function(t + dt, intermediate, k4);
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->state[i] += (k1[i] + TValue(2) * k2[i] + TValue(2) * k3[i] + k4[i]) * (dt * TValue(1.0 / 6.0));
+    }
+    return this->state;
+  }
+
+  inline const tState *State() const
+  {
+    return this->state;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tState state[Tchannels];
+
+};
+
+//! First-order IIR filter
+/*!
+ * y[n] = b0 * x[n] + b1 * x[n-1] - a1 * y[n-1] (transposed direct form II)
+ * The coefficients are dimensionless, so input and output have the same unit.
+ */
+template <typename TUnit, size_t Tchannels = 1, typename TValue = double>
+class tFirstOrderFilter
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tQuantity<TUnit, TValue> tSignal;
+
+  tFirstOrderFilter(TValue b0, TValue b1, TValue a1)
+    : b0(b0), b1(b1), a1(a1)
+  {
+    this->Reset(tSignal());
+  }
+
+  /*!
+   * Exponential smoothing low-pass with the given cutoff frequency
+   *
+   * \param cutoff Cutoff frequency
+   * \param sample_period Time between two updates
+   */
+  static tFirstOrderFilter LowPass(tQuantity<tSIUnit<0, 0, -1, 0, 0, 0, 0>, TValue> cutoff, tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> sample_period)
+  {
+    const TValue alpha = 1 - std::exp(-2 * TValue(M_PI) * (cutoff * sample_period).Value());
+    return tFirstOrderFilter(alpha, 0, alpha - 1);
+  }
+
+  /*!
+   * Sets the state to the steady state for constant input values
+   */
+  inline void Reset(tSignal value)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->state[i] = this->SteadyState(value);
+    }
+  }
+
+  inline void Reset(const tSignal *values)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->state[i] = this->SteadyState(values[i]);
+    }
+  }
+
+  /*!
+   * \param input Tchannels input samples
+   * \param output Tchannels filtered samples (may alias input)
+   */
+  inline void Update(const tSignal *input, tSignal *output)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      const tSignal x = input[i];
+      const tSignal y = x * this->b0 + this->state[i];
+      this->state[i] = x * this->b1 - y * this->a1;
+      output[i] = y;
+    }
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  TValue b0, b1, a1;
+  tSignal state[Tchannels];
+
+  inline tSignal SteadyState(tSignal x) const
+  {
+    const tSignal y = x * ((this->b0 + this->b1) / (1 + this->a1));
+    return x * this->b1 - y * this->a1;
+  }
+
+};
+
+//! Second-order IIR filter (biquad)
+/*!
+ * y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] - a1 * y[n-1] - a2 * y[n-2] (transposed direct form II)
+ * The coefficients are dimensionless, so input and output have the same unit.
+ */
+template <typename TUnit, size_t Tchannels = 1, typename TValue = double>
+class tSecondOrderFilter
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tQuantity<TUnit, TValue> tSignal;
+
+  tSecondOrderFilter(TValue b0, TValue b1, TValue b2, TValue a1, TValue a2)
+    : b0(b0), b1(b1), b2(b2), a1(a1), a2(a2)
+  {
+    this->Reset(tSignal());
+  }
+
+  /*!
+   * Low-pass from the bilinear transform of an analog second-order low-pass
+   *
+   * \param cutoff Cutoff frequency (must be below half the sample rate)
+   * \param sample_period Time between two updates
+   * \param quality Quality factor (the default gives a Butterworth filter)
+   */
+  static tSecondOrderFilter LowPass(tQuantity<tSIUnit<0, 0, -1, 0, 0, 0, 0>, TValue> cutoff, tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> sample_period, TValue quality = TValue(M_SQRT1_2))
+  {
+    const TValue omega = 2 * TValue(M_PI) * (cutoff * sample_period).Value();
+    const TValue cos_omega = std::cos(omega);
+    const TValue alpha = std::sin(omega) / (2 * quality);
+    const TValue a0 = 1 + alpha;
+    return tSecondOrderFilter((1 - cos_omega) / (2 * a0), (1 - cos_omega) / a0, (1 - cos_omega) / (2 * a0), -2 * cos_omega / a0, (1 - alpha) / a0);
+  }
+
+  /*!
+   * Sets the state to the steady state for constant input values
+   */
+  inline void Reset(tSignal value)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->SetSteadyState(i, value);
+    }
+  }
+
+  inline void Reset(const tSignal *values)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->SetSteadyState(i, values[i]);
+    }
+  }
+
+  /*!
+   * \param input Tchannels input samples
+   * \param output Tchannels filtered samples (may alias input)
+   */
+  inline void Update(const tSignal *input, tSignal *output)
+  {
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      const tSignal x = input[i];
+      const tSignal y = x * this->b0 + this->state1[i];
+      this->state1[i] = x * this->b1 - y * this->a1 + this->state2[i];
+      this->state2[i] = x * this->b2 - y * this->a2;
+      output[i] = y;
+    }
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  TValue b0, b1, b2, a1, a2;
+  tSignal state1[Tchannels];
+  tSignal state2[Tchannels];
+
+  inline void SetSteadyState(size_t channel, tSignal x)
+  {
+    const tSignal y = x * ((this->b0 + this->b1 + this->b2) / (1 + this->a1 + this->a2));
+    this->state2[channel] = x * this->b2 - y * this->a2;
+    this->state1[channel] = x * this->b1 - y * this->a1 + this->state2[channel];
+  }
+
+};
+
+//! Finite-difference derivative
+/*!
+ * output = (input[n] - input[n-1]) / dt, e.g. differentiating tLength yields tVelocity.
+ * The first update after construction or Reset() yields zero.
+ */
+template <typename TUnit, size_t Tchannels = 1, typename TValue = double>
+class tDerivative
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tQuantity<TUnit, TValue> tInput;
+  typedef tQuantity<typename operators::tQuotient<TUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tResult, TValue> tOutput;
+  typedef tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> tTimeStep;
+
+  tDerivative()
+  {
+    this->Reset();
+  }
+
+  inline void Reset()
+  {
+    this->initialized = false;
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      this->previous[i] = tInput();
+    }
+  }
+
+  /*!
+   * \param input Tchannels input samples
+   * \param dt Time since the previous update
+   * \param output Tchannels derivatives
+   */
+  inline void Update(const tInput *input, tTimeStep dt, tOutput *output)
+  {
+    const tQuantity<tSIUnit<0, 0, -1, 0, 0, 0, 0>, TValue> inverse_dt(this->initialized ? 1 / dt.Value() : 0);
+    for (size_t i = 0; i < Tchannels; ++i)
+    {
+      output[i] = (input[i] - this->previous[i]) * inverse_dt;
+      this->previous[i] = input[i];
+    }
+    this->initialized = true;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  bool initialized;
+  tInput previous[Tchannels];
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
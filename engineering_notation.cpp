@@ -0,0 +1,134 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/engineering_notation.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace
+{
+
+struct tPrefix
+{
+  const char *symbol;
+  double factor;
+};
+
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+// prefixes in steps of 10^3, accepted by internal::GetFactorToBaseUnit
+const tPrefix cENGINEERING_PREFIXES[] =
+{
+  { "y", cYOCTO }, { "z", cZEPTO }, { "a", cATTO }, { "f", cFEMTO }, { "p", cPICO }, { "n", cNANO }, { "µ", cMICRO }, { "m", cMILLI },
+  { "", cNO_PREFIX },
+  { "k", cKILO }, { "M", cMEGA }, { "G", cGIGA }, { "T", cTERA }, { "P", cPETA }, { "E", cEXA }, { "Z", cZETTA }, { "Y", cYOTTA }
+};
+const int cNO_PREFIX_INDEX = 8;
+const int cMAX_PREFIX_INDEX = sizeof(cENGINEERING_PREFIXES) / sizeof(cENGINEERING_PREFIXES[0]) - 1;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// EngineeringNotationIOSIndex
+//----------------------------------------------------------------------
+int EngineeringNotationIOSIndex()
+{
+  static int index = std::ios_base::xalloc();
+  return index;
+}
+
+//----------------------------------------------------------------------
+// WriteEngineeringNotation
+//----------------------------------------------------------------------
+std::ostream &WriteEngineeringNotation(std::ostream &stream, double value, const char *prefixable_base_symbol, double base_symbol_factor)
+{
+  double scaled = value / base_symbol_factor;
+  int index = cNO_PREFIX_INDEX;
+  if (scaled != 0 && std::isfinite(scaled))
+  {
+    const double magnitude = std::fabs(scaled);
+    index = std::min(cMAX_PREFIX_INDEX, std::max(0, cNO_PREFIX_INDEX + static_cast<int>(std::floor(std::log10(magnitude) / 3))));
+
+    // values that round up to 1000 at the stream's precision (e.g. 999.9999) get the next prefix
+    const double scaled_magnitude = magnitude / cENGINEERING_PREFIXES[index].factor;
+    const bool default_format = (stream.flags() & std::ios_base::floatfield) == std::ios_base::fmtflags(0);
+    const int digits = std::max<int>(1, stream.precision());
+    if (default_format && index < cMAX_PREFIX_INDEX && scaled_magnitude >= 1000 * (1 - 0.5 * std::pow(10.0, -digits)))
+    {
+      ++index;
+    }
+    scaled /= cENGINEERING_PREFIXES[index].factor;
+  }
+  stream << scaled << " " << cENGINEERING_PREFIXES[index].symbol << prefixable_base_symbol;
+  return stream;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
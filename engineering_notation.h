@@ -0,0 +1,169 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/engineering_notation.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Output of quantities with an automatically chosen SI prefix
+ * (e.g. "5 µm" or "3 MHz" instead of "5e-06 m" or "3e+06 Hz").
+ *
+ * Usage:
+ *   std::cout << EngineeringNotation << length;     // stream manipulator
+ *   std::string text = FormatEngineeringNotation(length);
+ *
+ * Only units with a prefixable base symbol in tSymbolParser are written
+ * with prefixes, so the output parses back to the same quantity. Other
+ * units and non-arithmetic value types keep the base-unit output.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__engineering_notation_h__
+#define __rrlib__si_units__engineering_notation_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <ios>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tSymbolParser.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+RRLIB_SI_UNITS_BEGIN_QUANTITY_NAMESPACE
+template <typename TUnit, typename TValue>
+class tQuantity;
+RRLIB_SI_UNITS_END_QUANTITY_NAMESPACE
+
+namespace internal
+{
+
+/*!
+ * \return Index of the stream flag that enables engineering notation
+ */
+int EngineeringNotationIOSIndex();
+
+/*!
+ * Writes value (in the base unit) with the SI prefix that brings its magnitude into [1, 1000).
+ * The prefix is looked up from the decimal exponent, the value is scaled with a single division.
+ *
+ * \param prefixable_base_symbol Symbol the prefix is put in front of (e.g. "g" for mass)
+ * \param base_symbol_factor Factor from prefixable_base_symbol to the base unit (e.g. 0.001 for "g")
+ */
+std::ostream &WriteEngineeringNotation(std::ostream &stream, double value, const char *prefixable_base_symbol, double base_symbol_factor);
+
+template <typename TUnit>
+double PrefixableBaseSymbolFactor()
+{
+  static const double factor = tSymbolParser<TUnit>::GetFactorToBaseUnit(tSymbolParser<TUnit>::PrefixableBaseSymbol());
+  return factor;
+}
+
+/*!
+ * Writes value in engineering notation if it is enabled for stream and supported for TUnit
+ *
+ * \return Whether value was written
+ */
+template <typename TUnit, typename TValue>
+inline bool TryWriteEngineeringNotation(std::ostream &stream, TValue value, std::true_type)
+{
+  const char *symbol = tSymbolParser<TUnit>::PrefixableBaseSymbol();
+  if (!symbol || !stream.iword(EngineeringNotationIOSIndex()))
+  {
+    return false;
+  }
+  WriteEngineeringNotation(stream, static_cast<double>(value), symbol, PrefixableBaseSymbolFactor<TUnit>());
+  return true;
+}
+
+template <typename TUnit, typename TValue>
+inline bool TryWriteEngineeringNotation(std::ostream &, const TValue &, std::false_type)
+{
+  return false;
+}
+
+}
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Stream manipulator: write quantities with automatically chosen SI prefixes
+ */
+inline std::ios_base &EngineeringNotation(std::ios_base &stream)
+{
+  stream.iword(internal::EngineeringNotationIOSIndex()) = 1;
+  return stream;
+}
+
+/*!
+ * Stream manipulator: write quantities in base units (the default)
+ */
+inline std::ios_base &BaseUnitNotation(std::ios_base &stream)
+{
+  stream.iword(internal::EngineeringNotationIOSIndex()) = 0;
+  return stream;
+}
+
+/*!
+ * \param precision Number of significant digits
+ * \return quantity in engineering notation (e.g. "4.7 kΩ")
+ */
+template <typename TUnit, typename TValue>
+std::string FormatEngineeringNotation(tQuantity<TUnit, TValue> quantity, int precision = 6)
+{
+  std::ostringstream stream;
+  stream.precision(precision);
+  stream << EngineeringNotation << quantity;
+  return stream.str();
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,171 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/explicit_instantiations.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Explicit instantiation declarations (extern template) for the quantity
+ * types registered in rtti.cpp. Included at the end of si_units.h as it
+ * needs the unit typedefs. Translation units that use these types
+ * no longer instantiate the class, its operators, streaming and symbol
+ * parsing themselves; the definitions are compiled once in
+ * explicit_instantiations.cpp. The serialization operators are covered
+ * for double and float values only - angle quantities still instantiate
+ * them locally. rtti::TypeName is not covered, as its Get() is defined in
+ * the class body and thus inline, which extern template cannot suppress.
+ *
+ * Define RRLIB_SI_UNITS_NO_EXTERN_TEMPLATES to instantiate everything
+ * locally again (e.g. to compare build times, see
+ * tests/measure_instantiations.sh). The declarations are also disabled
+ * with RRLIB_SI_UNITS_COUNT_OPERATIONS, as the library's instances are
+ * compiled without the operation counting hooks.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__explicit_instantiations_h__
+#define __rrlib__si_units__explicit_instantiations_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <ostream>
+#include <string>
+
+#include "rrlib/math/tAngle.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+// template arguments without commas for the macros below
+typedef tSIUnit<1, 0, -1, 0, 0, 0, 0> tVelocityUnit;
+typedef tSIUnit<1, 0, -2, 0, 0, 0, 0> tAccelerationUnit;
+typedef math::tAngle<double, math::angle::Radian, math::angle::NoWrap> tRadianDouble;
+typedef math::tAngle<float, math::angle::Radian, math::angle::NoWrap> tRadianFloat;
+typedef math::tAngle<double, math::angle::Degree, math::angle::NoWrap> tDegreeDouble;
+typedef math::tAngle<float, math::angle::Degree, math::angle::NoWrap> tDegreeFloat;
+
+}
+
+//----------------------------------------------------------------------
+// Explicit instantiations
+//----------------------------------------------------------------------
+
+// prefix is extern for declarations and empty for definitions
+
+#define RRLIB_SI_UNITS_UNIT_TEMPLATES(prefix, TUnit) \
+  prefix template double GetCachedFactorToBaseUnit<TUnit>(const std::string &);
+
+#define RRLIB_SI_UNITS_QUANTITY_TEMPLATES(prefix, TUnit, TValue) \
+  prefix template class tQuantity<TUnit, TValue>; \
+  prefix template std::ostream &operator << <TUnit, TValue>(std::ostream &, tQuantity<TUnit, TValue>);
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+#define RRLIB_SI_UNITS_SERIALIZATION_TEMPLATES(prefix, TUnit, TValue) \
+  prefix template serialization::tOutputStream &operator << <TUnit, TValue>(serialization::tOutputStream &, tQuantity<TUnit, TValue>); \
+  prefix template serialization::tInputStream &operator >> <TUnit, TValue>(serialization::tInputStream &, tQuantity<TUnit, TValue> &); \
+  prefix template serialization::tStringOutputStream &operator << <TUnit, TValue>(serialization::tStringOutputStream &, tQuantity<TUnit, TValue>); \
+  prefix template serialization::tStringInputStream &operator >> <TUnit, TValue>(serialization::tStringInputStream &, tQuantity<TUnit, TValue> &);
+#else
+#define RRLIB_SI_UNITS_SERIALIZATION_TEMPLATES(prefix, TUnit, TValue)
+#endif
+
+#define RRLIB_SI_UNITS_ARITHMETIC_TEMPLATES(prefix, TUnit, TValue) \
+  RRLIB_SI_UNITS_QUANTITY_TEMPLATES(prefix, TUnit, TValue) \
+  RRLIB_SI_UNITS_SERIALIZATION_TEMPLATES(prefix, TUnit, TValue) \
+  prefix template tQuantity<TUnit, TValue> operator - <TUnit, TValue>(tQuantity<TUnit, TValue>); \
+  prefix template tQuantity<TUnit, TValue> operator + <TUnit, TValue, TValue>(tQuantity<TUnit, TValue>, tQuantity<TUnit, TValue>); \
+  prefix template tQuantity<TUnit, TValue> operator - <TUnit, TValue, TValue>(tQuantity<TUnit, TValue>, tQuantity<TUnit, TValue>); \
+  prefix template tQuantity<TUnit, TValue> operator * <TUnit, TValue, TValue>(tQuantity<TUnit, TValue>, TValue); \
+  prefix template tQuantity<TUnit, TValue> operator * <TUnit, TValue, TValue>(TValue, tQuantity<TUnit, TValue>); \
+  prefix template tQuantity<TUnit, decltype(TValue() / double())> operator / <TUnit, TValue>(tQuantity<TUnit, TValue>, double); \
+  prefix template bool operator == <TUnit, TValue, TValue>(tQuantity<TUnit, TValue>, tQuantity<TUnit, TValue>); \
+  prefix template bool operator != <TUnit, TValue, TValue>(tQuantity<TUnit, TValue>, tQuantity<TUnit, TValue>); \
+  prefix template bool operator < <TUnit, TValue, TValue>(tQuantity<TUnit, TValue>, tQuantity<TUnit, TValue>); \
+  prefix template bool operator > <TUnit, TValue, TValue>(tQuantity<TUnit, TValue>, tQuantity<TUnit, TValue>); \
+  prefix template bool operator <= <TUnit, TValue, TValue>(tQuantity<TUnit, TValue>, tQuantity<TUnit, TValue>); \
+  prefix template bool operator >= <TUnit, TValue, TValue>(tQuantity<TUnit, TValue>, tQuantity<TUnit, TValue>);
+
+#define RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, TUnit) \
+  RRLIB_SI_UNITS_UNIT_TEMPLATES(prefix, TUnit) \
+  RRLIB_SI_UNITS_ARITHMETIC_TEMPLATES(prefix, TUnit, double) \
+  RRLIB_SI_UNITS_ARITHMETIC_TEMPLATES(prefix, TUnit, float)
+
+// the types registered in rtti.cpp
+#define RRLIB_SI_UNITS_EXPLICIT_INSTANTIATIONS(prefix) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tMeter) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tKilogram) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tSecond) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tAmpere) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tKelvin) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tMole) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tCandela) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tHertz) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tNewton) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tPascal) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tJoule) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tWatt) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tCoulomb) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tVolt) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tFarad) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tOhm) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tWeber) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, tTesla) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, internal::tVelocityUnit) \
+  RRLIB_SI_UNITS_COMMON_UNIT_TEMPLATES(prefix, internal::tAccelerationUnit) \
+  RRLIB_SI_UNITS_QUANTITY_TEMPLATES(prefix, tHertz, internal::tRadianDouble) \
+  RRLIB_SI_UNITS_QUANTITY_TEMPLATES(prefix, tHertz, internal::tRadianFloat) \
+  RRLIB_SI_UNITS_QUANTITY_TEMPLATES(prefix, tHertz, internal::tDegreeDouble) \
+  RRLIB_SI_UNITS_QUANTITY_TEMPLATES(prefix, tHertz, internal::tDegreeFloat)
+
+#if !defined(RRLIB_SI_UNITS_NO_EXTERN_TEMPLATES) && !defined(RRLIB_SI_UNITS_COUNT_OPERATIONS)
+RRLIB_SI_UNITS_EXPLICIT_INSTANTIATIONS(extern)
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
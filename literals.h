@@ -0,0 +1,152 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/literals.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * User-defined literals for common quantities, e.g. 5_mm, 3.6_km_h,
+ * 10_kN or 250_us. They are evaluated at compile time to base-unit
+ * quantities with TValue double, using the prefix constants from
+ * si_units.h.
+ *
+ * Usage:
+ *   using namespace rrlib::si_units::literals;
+ *   constexpr tLength<> cWHEEL_RADIUS = 35_mm;
+ *
+ * Suffixes use '_' in place of '/' (km_h is km/h, m_s2 is m/s^2).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__literals_h__
+#define __rrlib__si_units__literals_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+namespace literals
+{
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+// Defines the literal operators for integer and floating point literals of one unit
+#define RRLIB_SI_UNITS_DEFINE_LITERAL(suffix, quantity, factor) \
+  inline constexpr quantity<> operator"" ## suffix(long double value) \
+  { \
+    return quantity<>(static_cast<double>(value) * (factor)); \
+  } \
+  inline constexpr quantity<> operator"" ## suffix(unsigned long long value) \
+  { \
+    return quantity<>(static_cast<double>(value) * (factor)); \
+  }
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_km, tLength, cKILO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_m, tLength, cNO_PREFIX)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_cm, tLength, cCENTI)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_mm, tLength, cMILLI)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_um, tLength, cMICRO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_nm, tLength, cNANO)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_t, tMass, cKILO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_kg, tMass, cNO_PREFIX)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_g, tMass, cMILLI)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_mg, tMass, cMICRO)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_h, tTime, 3600.0)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_min, tTime, 60.0)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_s, tTime, cNO_PREFIX)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_ms, tTime, cMILLI)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_us, tTime, cMICRO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_ns, tTime, cNANO)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_A, tElectricCurrent, cNO_PREFIX)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_mA, tElectricCurrent, cMILLI)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_K, tTemperature, cNO_PREFIX)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_GHz, tFrequency, cGIGA)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_MHz, tFrequency, cMEGA)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_kHz, tFrequency, cKILO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_Hz, tFrequency, cNO_PREFIX)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_MN, tForce, cMEGA)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_kN, tForce, cKILO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_N, tForce, cNO_PREFIX)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_mN, tForce, cMILLI)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_MPa, tPressure, cMEGA)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_kPa, tPressure, cKILO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_hPa, tPressure, cHECTO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_Pa, tPressure, cNO_PREFIX)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_bar, tPressure, 1E5)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_MJ, tEnergy, cMEGA)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_kJ, tEnergy, cKILO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_J, tEnergy, cNO_PREFIX)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_kWh, tEnergy, cKILO * 3600.0)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_MW, tPower, cMEGA)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_kW, tPower, cKILO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_W, tPower, cNO_PREFIX)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_mW, tPower, cMILLI)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_kV, tVoltage, cKILO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_V, tVoltage, cNO_PREFIX)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_mV, tVoltage, cMILLI)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_kOhm, tResistance, cKILO)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_Ohm, tResistance, cNO_PREFIX)
+
+RRLIB_SI_UNITS_DEFINE_LITERAL(_m_s, tVelocity, cNO_PREFIX)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_km_h, tVelocity, cKILO / 3600.0)
+RRLIB_SI_UNITS_DEFINE_LITERAL(_m_s2, tAcceleration, cNO_PREFIX)
+
+#undef RRLIB_SI_UNITS_DEFINE_LITERAL
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
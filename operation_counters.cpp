@@ -0,0 +1,316 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/operation_counters.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+// distinct (operation, left, right) combinations per thread - further ones are counted as dropped
+const size_t cOPERATION_COUNTER_CAPACITY = 1024;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+// operation in the top byte, the packed dimension (7 bytes) below
+typedef std::pair<uint64_t, uint64_t> tCounterKey;
+
+inline tCounterKey MakeKey(tArithmeticOperation operation, tDimension left, tDimension right)
+{
+  return tCounterKey(static_cast<uint64_t>(operation) << 56 | left.Packed(), right.Packed());
+}
+
+struct tCounterEntry
+{
+  std::atomic<bool> used;
+  tCounterKey key;  // written by the owning thread before used is set
+  std::atomic<uint64_t> count;
+};
+
+/*!
+ * Open-addressing table of one thread. Only the owner inserts; other threads
+ * read published entries and reset counts, so no locks are needed.
+ */
+struct tThreadCounters
+{
+  tCounterEntry entries[cOPERATION_COUNTER_CAPACITY];
+  std::atomic<uint64_t> dropped;
+
+  tThreadCounters();
+  ~tThreadCounters();
+
+  void Count(const tCounterKey &key)
+  {
+    size_t index = static_cast<size_t>((key.first * 0x9E3779B97F4A7C15ULL ^ key.second * 0xC2B2AE3D27D4EB4FULL) >> 32);
+    for (size_t probe = 0; probe < cOPERATION_COUNTER_CAPACITY; ++probe, ++index)
+    {
+      tCounterEntry &entry = this->entries[index & (cOPERATION_COUNTER_CAPACITY - 1)];
+      if (!entry.used.load(std::memory_order_relaxed))
+      {
+        entry.key = key;
+        entry.count.store(1, std::memory_order_relaxed);
+        entry.used.store(true, std::memory_order_release);
+        return;
+      }
+      if (entry.key == key)
+      {
+        entry.count.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+    }
+    this->dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  template <typename TFunction>
+  void ForEach(TFunction function)
+  {
+    for (tCounterEntry & entry : this->entries)
+    {
+      if (entry.used.load(std::memory_order_acquire))
+      {
+        function(entry);
+      }
+    }
+  }
+};
+
+struct tCounterRegistry
+{
+  std::mutex mutex;
+  std::vector<tThreadCounters *> threads;
+  std::map<tCounterKey, uint64_t> finished_threads;
+  uint64_t dropped = 0;
+};
+
+tCounterRegistry &CounterRegistry()
+{
+  static tCounterRegistry registry;
+  return registry;
+}
+
+tThreadCounters::tThreadCounters() :
+  dropped(0)
+{
+  for (tCounterEntry & entry : this->entries)
+  {
+    entry.used.store(false, std::memory_order_relaxed);
+    entry.count.store(0, std::memory_order_relaxed);
+  }
+  tCounterRegistry &registry = CounterRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.threads.push_back(this);
+}
+
+tThreadCounters::~tThreadCounters()
+{
+  tCounterRegistry &registry = CounterRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  this->ForEach([&registry](tCounterEntry & entry)
+  {
+    registry.finished_threads[entry.key] += entry.count.load(std::memory_order_relaxed);
+  });
+  registry.dropped += this->dropped.load(std::memory_order_relaxed);
+  registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+}
+
+}
+
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// RecordOperation
+//----------------------------------------------------------------------
+void RecordOperation(tArithmeticOperation operation, tDimension left, tDimension right)
+{
+  thread_local tThreadCounters counters;
+  counters.Count(MakeKey(operation, left, right));
+}
+
+}
+
+//----------------------------------------------------------------------
+// GetOperationCounts
+//----------------------------------------------------------------------
+std::vector<tOperationCount> GetOperationCounts()
+{
+  tCounterRegistry &registry = CounterRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  std::map<tCounterKey, uint64_t> merged = registry.finished_threads;
+  for (tThreadCounters * thread : registry.threads)
+  {
+    thread->ForEach([&merged](tCounterEntry & entry)
+    {
+      merged[entry.key] += entry.count.load(std::memory_order_relaxed);
+    });
+  }
+
+  std::vector<tOperationCount> result;
+  for (auto & counter : merged)
+  {
+    if (counter.second)
+    {
+      result.push_back(tOperationCount { static_cast<tArithmeticOperation>(counter.first.first >> 56), tDimension(counter.first.first & ((uint64_t(1) << 56) - 1)), tDimension(counter.first.second), counter.second });
+    }
+  }
+  std::stable_sort(result.begin(), result.end(), [](const tOperationCount & a, const tOperationCount & b)
+  {
+    return a.count > b.count;
+  });
+  return result;
+}
+
+//----------------------------------------------------------------------
+// ResetOperationCounts
+//----------------------------------------------------------------------
+void ResetOperationCounts()
+{
+  tCounterRegistry &registry = CounterRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.finished_threads.clear();
+  registry.dropped = 0;
+  for (tThreadCounters * thread : registry.threads)
+  {
+    thread->ForEach([](tCounterEntry & entry)
+    {
+      entry.count.store(0, std::memory_order_relaxed);
+    });
+    thread->dropped.store(0, std::memory_order_relaxed);
+  }
+}
+
+//----------------------------------------------------------------------
+// DumpOperationCounts
+//----------------------------------------------------------------------
+void DumpOperationCounts(std::ostream &stream)
+{
+  static const char *cOPERATION_SYMBOLS[] = { "+", "-", "*", "/" };
+
+  // different dimensions may share a printed symbol (e.g. with user-defined symbols), so lines are merged by text
+  std::vector<std::pair<std::string, uint64_t>> lines;
+  for (const tOperationCount & count : GetOperationCounts())
+  {
+    std::stringstream line;
+    line.copyfmt(stream);
+    if (count.left.IsDimensionless())
+    {
+      line << "1";
+    }
+    else
+    {
+      line << count.left;
+    }
+    line << " " << cOPERATION_SYMBOLS[count.operation] << " ";
+    if (count.right.IsDimensionless())
+    {
+      line << "1";
+    }
+    else
+    {
+      line << count.right;
+    }
+    auto existing = std::find_if(lines.begin(), lines.end(), [&line](const std::pair<std::string, uint64_t> &entry)
+    {
+      return entry.first == line.str();
+    });
+    if (existing != lines.end())
+    {
+      existing->second += count.count;
+    }
+    else
+    {
+      lines.emplace_back(line.str(), count.count);
+    }
+  }
+  for (auto & line : lines)
+  {
+    stream << line.first << ": " << line.second << std::endl;
+  }
+
+  uint64_t dropped = 0;
+  {
+    tCounterRegistry &registry = CounterRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    dropped = registry.dropped;
+    for (tThreadCounters * thread : registry.threads)
+    {
+      dropped += thread->dropped.load(std::memory_order_relaxed);
+    }
+  }
+  if (dropped)
+  {
+    stream << "(" << dropped << " operations not counted - counter table full)" << std::endl;
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
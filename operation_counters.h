@@ -0,0 +1,148 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/operation_counters.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Optional counters of arithmetic operations per pair of operand units
+ * for profiling builds (e.g. how many N / m divisions happen per control
+ * cycle).
+ *
+ * Counting is enabled by defining RRLIB_SI_UNITS_COUNT_OPERATIONS for all
+ * translation units (including this library). Otherwise the hooks in the
+ * tQuantity operators expand to nothing. Each thread counts into its own
+ * lock-free table; GetOperationCounts() and DumpOperationCounts() merge
+ * the tables of all running and finished threads.
+ *
+ * With counting, tQuantity is declared in the inline namespace
+ * counted_operations. Its members and all function templates taking
+ * quantities are then distinct entities from the uncounted instances in
+ * a library built without counting, so the linker cannot pick those.
+ * Operations inside such a library are not counted, and rtti types it
+ * registered do not match the quantity types of counting code.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__operation_counters_h__
+#define __rrlib__si_units__operation_counters_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tDimension.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+enum tArithmeticOperation
+{
+  eAO_ADD,
+  eAO_SUBTRACT,
+  eAO_MULTIPLY,
+  eAO_DIVIDE
+};
+
+/*! Number of operations with operands of the given dimensions (scalars are dimensionless) */
+struct tOperationCount
+{
+  tArithmeticOperation operation;
+  tDimension left;
+  tDimension right;
+  uint64_t count;
+};
+
+namespace internal
+{
+
+/*!
+ * Counts one operation in the table of the calling thread
+ */
+void RecordOperation(tArithmeticOperation operation, tDimension left, tDimension right);
+
+template <typename TLeftUnit, typename TRightUnit>
+inline void CountOperation(tArithmeticOperation operation)
+{
+  RecordOperation(operation, tDimension(TLeftUnit()), tDimension(TRightUnit()));
+}
+
+}
+
+#ifdef RRLIB_SI_UNITS_COUNT_OPERATIONS
+#define RRLIB_SI_UNITS_COUNT_OPERATION(operation, ...) ::rrlib::si_units::internal::CountOperation<__VA_ARGS__>(::rrlib::si_units::operation)
+#define RRLIB_SI_UNITS_BEGIN_QUANTITY_NAMESPACE inline namespace counted_operations {
+#define RRLIB_SI_UNITS_END_QUANTITY_NAMESPACE }
+#else
+#define RRLIB_SI_UNITS_COUNT_OPERATION(operation, ...)
+#define RRLIB_SI_UNITS_BEGIN_QUANTITY_NAMESPACE
+#define RRLIB_SI_UNITS_END_QUANTITY_NAMESPACE
+#endif
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * \return Counts of all threads, merged and sorted by decreasing count
+ */
+std::vector<tOperationCount> GetOperationCounts();
+
+/*!
+ * Sets all counters of all threads to zero
+ */
+void ResetOperationCounts();
+
+/*!
+ * Writes one line per operation and operand units, e.g. "N / m: 1000"
+ * (scalars are written as 1)
+ */
+void DumpOperationCounts(std::ostream &stream);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
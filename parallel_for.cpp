@@ -0,0 +1,115 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/parallel_for.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// ParallelFor
+//----------------------------------------------------------------------
+void ParallelFor(size_t size, size_t minimum_block_size, const std::function<void(size_t begin, size_t end)> &function, unsigned int number_of_threads, size_t block_alignment)
+{
+  if (number_of_threads == 0)
+  {
+    number_of_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  size_t number_of_blocks = std::min<size_t>(number_of_threads, size / std::max<size_t>(1, minimum_block_size));
+  if (number_of_blocks <= 1)
+  {
+    if (size > 0)
+    {
+      function(0, size);
+    }
+    return;
+  }
+
+  size_t block_size = (size + number_of_blocks - 1) / number_of_blocks;
+  block_alignment = std::max<size_t>(1, block_alignment);
+  block_size = (block_size + block_alignment - 1) / block_alignment * block_alignment;
+
+  std::vector<std::thread> threads;
+  threads.reserve(number_of_blocks);
+  for (size_t begin = block_size; begin < size; begin += block_size)
+  {
+    threads.emplace_back(function, begin, std::min(size, begin + block_size));
+  }
+  function(0, std::min(size, block_size));
+  for (auto & thread : threads)
+  {
+    thread.join();
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
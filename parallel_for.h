@@ -0,0 +1,86 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/parallel_for.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Splitting of large index ranges across threads for the bulk
+ * operations on quantity buffers
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__parallel_for_h__
+#define __rrlib__si_units__parallel_for_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+#include <functional>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Calls function for consecutive blocks [begin, end) covering [0, size).
+ * Ranges smaller than two minimum blocks are processed in the calling thread.
+ * Block boundaries are multiples of block_alignment elements (64 by default)
+ * so that vectorized loops only have a scalar tail in the last block.
+ *
+ * \param size Number of elements
+ * \param minimum_block_size Minimum number of elements worth an own thread
+ * \param function Function that is called for every block (possibly concurrently)
+ * \param number_of_threads Maximum number of threads to use (0 for the number of hardware threads)
+ * \param block_alignment Block boundaries are multiples of this number of elements
+ */
+void ParallelFor(size_t size, size_t minimum_block_size, const std::function<void(size_t begin, size_t end)> &function, unsigned int number_of_threads = 0, size_t block_alignment = 64);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
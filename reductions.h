@@ -0,0 +1,453 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/reductions.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Unit-correct reductions (sum, mean, minimum, maximum, sum of squares,
+ * RMS) and threshold predicates over contiguous quantity buffers.
+ *
+ * The kernels keep 8 independent accumulators so that compilers turn them
+ * into SIMD code without a loop-carried dependency on a single register.
+ * Large buffers are split across threads with internal::ParallelFor and
+ * the partial results are combined in a fixed order, so results only
+ * depend on the number of threads, not on scheduling.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__reductions_h__
+#define __rrlib__si_units__reductions_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tQuantity.h"
+#include "rrlib/si_units/parallel_for.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Buffers with fewer elements are reduced in the calling thread */
+const size_t cMINIMUM_PARALLEL_REDUCTION_SIZE = 1 << 17;
+
+namespace internal
+{
+
+/*! Accumulator type for reductions (wide integers for integral values) */
+template <typename TValue>
+struct tReductionAccumulator
+{
+  typedef typename std::conditional < std::is_floating_point<TValue>::value, TValue,
+          typename std::conditional<std::is_signed<TValue>::value, int64_t, uint64_t>::type >::type tType;
+};
+
+template <typename TUnit, typename TValue>
+inline const TValue *RawValues(const tQuantity<TUnit, TValue> *quantities)
+{
+  static_assert(std::is_arithmetic<TValue>::value, "Reductions are only supported for arithmetic value types");
+  static_assert(sizeof(tQuantity<TUnit, TValue>) == sizeof(TValue) && std::is_standard_layout<tQuantity<TUnit, TValue>>::value, "tQuantity must have the layout of its value");
+  return reinterpret_cast<const TValue *>(quantities);
+}
+
+/*!
+ * Reduces [0, size) with kernel(begin, end) per block and combines the
+ * partial results in the order of their blocks
+ */
+template <typename TResult, typename TKernel, typename TCombine>
+TResult ParallelReduce(size_t size, TKernel kernel, TCombine combine, unsigned int number_of_threads)
+{
+  std::vector<std::pair<size_t, TResult>> partial_results;
+  std::mutex mutex;
+  ParallelFor(size, cMINIMUM_PARALLEL_REDUCTION_SIZE, [&](size_t begin, size_t end)
+  {
+    TResult result = kernel(begin, end);
+    std::lock_guard<std::mutex> lock(mutex);
+    partial_results.emplace_back(begin, result);
+  }, number_of_threads);
+  std::sort(partial_results.begin(), partial_results.end(), [](const std::pair<size_t, TResult> &a, const std::pair<size_t, TResult> &b)
+  {
+    return a.first < b.first;
+  });
+  TResult result = partial_results.front().second;
+  for (size_t i = 1; i < partial_results.size(); ++i)
+  {
+    result = combine(result, partial_results[i].second);
+  }
+  return result;
+}
+
+template <typename TAccumulator, typename TValue>
+TAccumulator SumKernel(const TValue *__restrict__ values, size_t count)
+{
+  TAccumulator accumulators[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    for (size_t k = 0; k < 8; ++k)
+    {
+      accumulators[k] += static_cast<TAccumulator>(values[i + k]);
+    }
+  }
+  for (; i < count; ++i)
+  {
+    accumulators[i & 7] += static_cast<TAccumulator>(values[i]);
+  }
+  return ((accumulators[0] + accumulators[4]) + (accumulators[1] + accumulators[5])) + ((accumulators[2] + accumulators[6]) + (accumulators[3] + accumulators[7]));
+}
+
+template <typename TAccumulator, typename TValue>
+TAccumulator SumOfSquaresKernel(const TValue *__restrict__ values, size_t count)
+{
+  TAccumulator accumulators[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    for (size_t k = 0; k < 8; ++k)
+    {
+      const TAccumulator value = static_cast<TAccumulator>(values[i + k]);
+      accumulators[k] += value * value;
+    }
+  }
+  for (; i < count; ++i)
+  {
+    const TAccumulator value = static_cast<TAccumulator>(values[i]);
+    accumulators[i & 7] += value * value;
+  }
+  return ((accumulators[0] + accumulators[4]) + (accumulators[1] + accumulators[5])) + ((accumulators[2] + accumulators[6]) + (accumulators[3] + accumulators[7]));
+}
+
+template <typename TValue, typename TLess>
+TValue ExtremumKernel(const TValue *__restrict__ values, size_t count, TLess less)
+{
+  TValue accumulators[8];
+  std::fill(accumulators, accumulators + 8, values[0]);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    for (size_t k = 0; k < 8; ++k)
+    {
+      accumulators[k] = less(values[i + k], accumulators[k]) ? values[i + k] : accumulators[k];
+    }
+  }
+  for (; i < count; ++i)
+  {
+    accumulators[0] = less(values[i], accumulators[0]) ? values[i] : accumulators[0];
+  }
+  TValue result = accumulators[0];
+  for (size_t k = 1; k < 8; ++k)
+  {
+    result = less(accumulators[k], result) ? accumulators[k] : result;
+  }
+  return result;
+}
+
+template <typename TValue, typename TPredicate>
+void MaskKernel(const TValue *__restrict__ values, size_t begin, size_t end, uint64_t *__restrict__ mask, TPredicate predicate)
+{
+  // begin is a multiple of 64 (see ParallelFor), so every word is written by exactly one block
+  for (size_t word_begin = begin; word_begin < end; word_begin += 64)
+  {
+    const size_t word_end = std::min(end, word_begin + 64);
+    uint64_t word = 0;
+    for (size_t i = word_begin; i < word_end; ++i)
+    {
+      word |= static_cast<uint64_t>(predicate(values[i]) ? 1 : 0) << (i - word_begin);
+    }
+    mask[word_begin / 64] = word;
+  }
+}
+
+}
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * \return The number of 64 bit words needed for a bitmask of count elements
+ */
+inline size_t BitmaskSize(size_t count)
+{
+  return (count + 63) / 64;
+}
+
+/*!
+ * \return Whether bit index is set in mask
+ */
+inline bool BitmaskTest(const uint64_t *mask, size_t index)
+{
+  return (mask[index / 64] >> (index % 64)) & 1;
+}
+
+//----------------------------------------------------------------------
+// Reductions
+//----------------------------------------------------------------------
+/*!
+ * Sum of count quantities (integral values are accumulated in 64 bits)
+ */
+template <typename TUnit, typename TValue>
+tQuantity<TUnit, TValue> Sum(const tQuantity<TUnit, TValue> *quantities, size_t count, unsigned int number_of_threads = 0)
+{
+  typedef typename internal::tReductionAccumulator<TValue>::tType tAccumulator;
+  if (count == 0)
+  {
+    return tQuantity<TUnit, TValue>();
+  }
+  const TValue *values = internal::RawValues(quantities);
+  return tQuantity<TUnit, TValue>(static_cast<TValue>(internal::ParallelReduce<tAccumulator>(count, [values](size_t begin, size_t end)
+  {
+    return internal::SumKernel<tAccumulator>(values + begin, end - begin);
+  }, [](tAccumulator a, tAccumulator b)
+  {
+    return a + b;
+  }, number_of_threads)));
+}
+
+/*!
+ * Arithmetic mean of count quantities (zero for empty input)
+ */
+template <typename TUnit, typename TValue>
+tQuantity<TUnit, TValue> Mean(const tQuantity<TUnit, TValue> *quantities, size_t count, unsigned int number_of_threads = 0)
+{
+  typedef typename internal::tReductionAccumulator<TValue>::tType tAccumulator;
+  if (count == 0)
+  {
+    return tQuantity<TUnit, TValue>();
+  }
+  const TValue *values = internal::RawValues(quantities);
+  const tAccumulator sum = internal::ParallelReduce<tAccumulator>(count, [values](size_t begin, size_t end)
+  {
+    return internal::SumKernel<tAccumulator>(values + begin, end - begin);
+  }, [](tAccumulator a, tAccumulator b)
+  {
+    return a + b;
+  }, number_of_threads);
+  return tQuantity<TUnit, TValue>(static_cast<TValue>(sum / static_cast<tAccumulator>(count)));
+}
+
+/*!
+ * Smallest of count > 0 quantities
+ */
+template <typename TUnit, typename TValue>
+tQuantity<TUnit, TValue> Minimum(const tQuantity<TUnit, TValue> *quantities, size_t count, unsigned int number_of_threads = 0)
+{
+  assert(count > 0);
+  const TValue *values = internal::RawValues(quantities);
+  auto less = [](TValue a, TValue b)
+  {
+    return a < b;
+  };
+  return tQuantity<TUnit, TValue>(internal::ParallelReduce<TValue>(count, [values, less](size_t begin, size_t end)
+  {
+    return internal::ExtremumKernel(values + begin, end - begin, less);
+  }, [](TValue a, TValue b)
+  {
+    return std::min(a, b);
+  }, number_of_threads));
+}
+
+/*!
+ * Largest of count > 0 quantities
+ */
+template <typename TUnit, typename TValue>
+tQuantity<TUnit, TValue> Maximum(const tQuantity<TUnit, TValue> *quantities, size_t count, unsigned int number_of_threads = 0)
+{
+  assert(count > 0);
+  const TValue *values = internal::RawValues(quantities);
+  auto greater = [](TValue a, TValue b)
+  {
+    return a > b;
+  };
+  return tQuantity<TUnit, TValue>(internal::ParallelReduce<TValue>(count, [values, greater](size_t begin, size_t end)
+  {
+    return internal::ExtremumKernel(values + begin, end - begin, greater);
+  }, [](TValue a, TValue b)
+  {
+    return std::max(a, b);
+  }, number_of_threads));
+}
+
+/*!
+ * Sum of the squares of count quantities, e.g. N^2 for forces.
+ * Integral values are squared and accumulated in double.
+ */
+template <typename TUnit, typename TValue>
+tQuantity<typename operators::tProduct<TUnit, TUnit>::tResult, typename std::conditional<std::is_floating_point<TValue>::value, TValue, double>::type>
+SumOfSquares(const tQuantity<TUnit, TValue> *quantities, size_t count, unsigned int number_of_threads = 0)
+{
+  typedef typename std::conditional<std::is_floating_point<TValue>::value, TValue, double>::type tAccumulator;
+  typedef tQuantity<typename operators::tProduct<TUnit, TUnit>::tResult, tAccumulator> tResult;
+  if (count == 0)
+  {
+    return tResult();
+  }
+  const TValue *values = internal::RawValues(quantities);
+  return tResult(internal::ParallelReduce<tAccumulator>(count, [values](size_t begin, size_t end)
+  {
+    return internal::SumOfSquaresKernel<tAccumulator>(values + begin, end - begin);
+  }, [](tAccumulator a, tAccumulator b)
+  {
+    return a + b;
+  }, number_of_threads));
+}
+
+/*!
+ * Root mean square of count quantities (same unit as the input, zero for empty input)
+ */
+template <typename TUnit, typename TValue>
+tQuantity<TUnit, typename std::conditional<std::is_floating_point<TValue>::value, TValue, double>::type>
+RMS(const tQuantity<TUnit, TValue> *quantities, size_t count, unsigned int number_of_threads = 0)
+{
+  typedef typename std::conditional<std::is_floating_point<TValue>::value, TValue, double>::type tAccumulator;
+  if (count == 0)
+  {
+    return tQuantity<TUnit, tAccumulator>();
+  }
+  return tQuantity<TUnit, tAccumulator>(std::sqrt(SumOfSquares(quantities, count, number_of_threads).Value() / static_cast<tAccumulator>(count)));
+}
+
+//----------------------------------------------------------------------
+// Predicates
+//----------------------------------------------------------------------
+/*!
+ * Sets bit i of mask if quantities[i] > threshold
+ *
+ * \param mask Output with BitmaskSize(count) words
+ */
+template <typename TUnit, typename TValue>
+void GreaterMask(const tQuantity<TUnit, TValue> *quantities, size_t count, tQuantity<TUnit, TValue> threshold, uint64_t *mask, unsigned int number_of_threads = 0)
+{
+  const TValue *values = internal::RawValues(quantities);
+  const TValue limit = threshold.Value();
+  internal::ParallelFor(count, cMINIMUM_PARALLEL_REDUCTION_SIZE, [values, limit, mask](size_t begin, size_t end)
+  {
+    internal::MaskKernel(values, begin, end, mask, [limit](TValue value)
+    {
+      return value > limit;
+    });
+  }, number_of_threads);
+}
+
+/*!
+ * Sets bit i of mask if quantities[i] < threshold
+ *
+ * \param mask Output with BitmaskSize(count) words
+ */
+template <typename TUnit, typename TValue>
+void LessMask(const tQuantity<TUnit, TValue> *quantities, size_t count, tQuantity<TUnit, TValue> threshold, uint64_t *mask, unsigned int number_of_threads = 0)
+{
+  const TValue *values = internal::RawValues(quantities);
+  const TValue limit = threshold.Value();
+  internal::ParallelFor(count, cMINIMUM_PARALLEL_REDUCTION_SIZE, [values, limit, mask](size_t begin, size_t end)
+  {
+    internal::MaskKernel(values, begin, end, mask, [limit](TValue value)
+    {
+      return value < limit;
+    });
+  }, number_of_threads);
+}
+
+/*!
+ * Sets bit i of mask if IsEqual(a[i], b[i], max_error, method)
+ *
+ * \param mask Output with BitmaskSize(count) words
+ */
+template <typename TUnit, typename TValue>
+void IsEqualMask(const tQuantity<TUnit, TValue> *a, const tQuantity<TUnit, TValue> *b, size_t count, uint64_t *mask,
+                 float max_error = 1.0E-6, math::tFloatComparisonMethod method = math::eFCM_ABSOLUTE_ERROR, unsigned int number_of_threads = 0)
+{
+  internal::ParallelFor(count, cMINIMUM_PARALLEL_REDUCTION_SIZE, [a, b, mask, max_error, method](size_t begin, size_t end)
+  {
+    for (size_t word_begin = begin; word_begin < end; word_begin += 64)
+    {
+      const size_t word_end = std::min(end, word_begin + 64);
+      uint64_t word = 0;
+      for (size_t i = word_begin; i < word_end; ++i)
+      {
+        word |= static_cast<uint64_t>(IsEqual(a[i], b[i], max_error, method) ? 1 : 0) << (i - word_begin);
+      }
+      mask[word_begin / 64] = word;
+    }
+  }, number_of_threads);
+}
+
+/*!
+ * \return Whether any of count quantities is greater than threshold (e.g. "any force > limit")
+ */
+template <typename TUnit, typename TValue>
+bool AnyGreater(const tQuantity<TUnit, TValue> *quantities, size_t count, tQuantity<TUnit, TValue> threshold, unsigned int number_of_threads = 0)
+{
+  if (count == 0)
+  {
+    return false;
+  }
+  const TValue *values = internal::RawValues(quantities);
+  const TValue limit = threshold.Value();
+  return internal::ParallelReduce<bool>(count, [values, limit](size_t begin, size_t end)
+  {
+    bool any = false;
+    for (size_t i = begin; i < end; ++i)
+    {
+      any |= values[i] > limit;
+    }
+    return any;
+  }, [](bool a, bool b)
+  {
+    return a || b;
+  }, number_of_threads);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
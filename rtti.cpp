@@ -68,37 +68,53 @@ namespace si_units
 
 static rtti::tType init_types[] =
 {
-  rtti::tDataType<tLength<double>>(),
-  rtti::tDataType<tLength<float>>(),
-  rtti::tDataType<tMass<double>>(),
-  rtti::tDataType<tMass<float>>(),
-  rtti::tDataType<tTime<double>>(),
-  rtti::tDataType<tTime<float>>(),
-  rtti::tDataType<tElectricCurrent<double>>(),
-  rtti::tDataType<tElectricCurrent<float>>(),
-  rtti::tDataType<tTemperature<double>>(),
-  rtti::tDataType<tTemperature<float>>(),
-  rtti::tDataType<tAmountOfSubstance<double>>(),
-  rtti::tDataType<tAmountOfSubstance<float>>(),
-  rtti::tDataType<tLuminousIntensity<double>>(),
-  rtti::tDataType<tLuminousIntensity<float>>(),
+  RegisterQuantityType<tLength<double>>(),
+  RegisterQuantityType<tLength<float>>(),
+  RegisterQuantityType<tMass<double>>(),
+  RegisterQuantityType<tMass<float>>(),
+  RegisterQuantityType<tTime<double>>(),
+  RegisterQuantityType<tTime<float>>(),
+  RegisterQuantityType<tElectricCurrent<double>>(),
+  RegisterQuantityType<tElectricCurrent<float>>(),
+  RegisterQuantityType<tTemperature<double>>(),
+  RegisterQuantityType<tTemperature<float>>(),
+  RegisterQuantityType<tAmountOfSubstance<double>>(),
+  RegisterQuantityType<tAmountOfSubstance<float>>(),
+  RegisterQuantityType<tLuminousIntensity<double>>(),
+  RegisterQuantityType<tLuminousIntensity<float>>(),
 
-  rtti::tDataType<tFrequency<double>>(),
-  rtti::tDataType<tFrequency<float>>(),
-  rtti::tDataType<tForce<double>>(),
-  rtti::tDataType<tForce<float>>(),
-  rtti::tDataType<tPressure<double>>(),
-  rtti::tDataType<tPressure<float>>(),
+  RegisterQuantityType<tFrequency<double>>(),
+  RegisterQuantityType<tFrequency<float>>(),
+  RegisterQuantityType<tForce<double>>(),
+  RegisterQuantityType<tForce<float>>(),
+  RegisterQuantityType<tPressure<double>>(),
+  RegisterQuantityType<tPressure<float>>(),
+  RegisterQuantityType<tEnergy<double>>(),
+  RegisterQuantityType<tEnergy<float>>(),
+  RegisterQuantityType<tPower<double>>(),
+  RegisterQuantityType<tPower<float>>(),
+  RegisterQuantityType<tElectricCharge<double>>(),
+  RegisterQuantityType<tElectricCharge<float>>(),
+  RegisterQuantityType<tVoltage<double>>(),
+  RegisterQuantityType<tVoltage<float>>(),
+  RegisterQuantityType<tCapacitance<double>>(),
+  RegisterQuantityType<tCapacitance<float>>(),
+  RegisterQuantityType<tResistance<double>>(),
+  RegisterQuantityType<tResistance<float>>(),
+  RegisterQuantityType<tMagneticFlux<double>>(),
+  RegisterQuantityType<tMagneticFlux<float>>(),
+  RegisterQuantityType<tMagneticFluxDensity<double>>(),
+  RegisterQuantityType<tMagneticFluxDensity<float>>(),
 
-  rtti::tDataType<tVelocity<double>>(),
-  rtti::tDataType<tVelocity<float>>(),
-  rtti::tDataType<tAcceleration<double>>(),
-  rtti::tDataType<tAcceleration<float>>(),
+  RegisterQuantityType<tVelocity<double>>(),
+  RegisterQuantityType<tVelocity<float>>(),
+  RegisterQuantityType<tAcceleration<double>>(),
+  RegisterQuantityType<tAcceleration<float>>(),
 
-  rtti::tDataType<tAngularVelocity<double, math::angle::Radian>>(),
-  rtti::tDataType<tAngularVelocity<float, math::angle::Radian>>(),
-  rtti::tDataType<tAngularVelocity<double, math::angle::Degree>>(),
-  rtti::tDataType<tAngularVelocity<float, math::angle::Degree>>(),
+  RegisterQuantityType<tAngularVelocity<double, math::angle::Radian>>(),
+  RegisterQuantityType<tAngularVelocity<float, math::angle::Radian>>(),
+  RegisterQuantityType<tAngularVelocity<double, math::angle::Degree>>(),
+  RegisterQuantityType<tAngularVelocity<float, math::angle::Degree>>(),
 };
 
 //----------------------------------------------------------------------
@@ -45,9 +45,32 @@
 #define __rrlib__si_units__include_guard__
 
 #include "rrlib/si_units/tSIUnit.h"
+#include "rrlib/si_units/tDimension.h"
 #include "rrlib/si_units/tSymbolParser.h"
+#include "rrlib/si_units/tConversionFactorCache.h"
+#include "rrlib/si_units/operation_counters.h"
+#include "rrlib/si_units/engineering_notation.h"
 #include "rrlib/si_units/tQuantity.h"
+#include "rrlib/si_units/tTimePoint.h"
+#include "rrlib/si_units/tDynamicQuantity.h"
+#include "rrlib/si_units/compile_time_symbols.h"
+#include "rrlib/si_units/tSerializationTag.h"
+#include "rrlib/si_units/tQuantityFrame.h"
+#include "rrlib/si_units/tMemoryMappedFile.h"
+#include "rrlib/si_units/tTimeSeriesFile.h"
+#include "rrlib/si_units/column_parser.h"
+#include "rrlib/si_units/parallel_for.h"
+#include "rrlib/si_units/buffer_conversion.h"
+#include "rrlib/si_units/angle_kernels.h"
+#include "rrlib/si_units/quantity_math.h"
+#include "rrlib/si_units/reductions.h"
+#include "rrlib/si_units/tQuantityStatistics.h"
+#include "rrlib/si_units/tRingBuffer.h"
+#include "rrlib/si_units/control_blocks.h"
+#include "rrlib/si_units/tScopedSymbolContext.h"
 #include "rrlib/si_units/tUseSymbolStreamManipulator.h"
+#include "rrlib/si_units/tQuantityOperations.h"
+#include "rrlib/si_units/column_writer.h"
 #include "rrlib/si_units/rtti.h"
 
 #undef __rrlib__si_units__include_guard__
@@ -91,11 +114,27 @@ template <typename T = double> using tLuminousIntensity = tQuantity<tCandela, T>
 typedef tSIUnit < 0, 0, -1, 0, 0, 0, 0 > tHertz;
 typedef tSIUnit < 1, 1, -2, 0, 0, 0, 0 > tNewton;
 typedef tSIUnit < -1, 1, -2, 0, 0, 0, 0 > tPascal;
+typedef tSIUnit < 2, 1, -2, 0, 0, 0, 0 > tJoule;
+typedef tSIUnit < 2, 1, -3, 0, 0, 0, 0 > tWatt;
+typedef tSIUnit < 0, 0, 1, 1, 0, 0, 0 > tCoulomb;
+typedef tSIUnit < 2, 1, -3, -1, 0, 0, 0 > tVolt;
+typedef tSIUnit < -2, -1, 4, 2, 0, 0, 0 > tFarad;
+typedef tSIUnit < 2, 1, -3, -2, 0, 0, 0 > tOhm;
+typedef tSIUnit < 2, 1, -2, -1, 0, 0, 0 > tWeber;
+typedef tSIUnit < 0, 1, -2, -1, 0, 0, 0 > tTesla;
 
 // some derived quantities
 template <typename T = double> using tFrequency = tQuantity<tHertz, T>;
 template <typename T = double> using tForce = tQuantity<tNewton, T>;
 template <typename T = double> using tPressure = tQuantity<tPascal, T>;
+template <typename T = double> using tEnergy = tQuantity<tJoule, T>;
+template <typename T = double> using tPower = tQuantity<tWatt, T>;
+template <typename T = double> using tElectricCharge = tQuantity<tCoulomb, T>;
+template <typename T = double> using tVoltage = tQuantity<tVolt, T>;
+template <typename T = double> using tCapacitance = tQuantity<tFarad, T>;
+template <typename T = double> using tResistance = tQuantity<tOhm, T>;
+template <typename T = double> using tMagneticFlux = tQuantity<tWeber, T>;
+template <typename T = double> using tMagneticFluxDensity = tQuantity<tTesla, T>;
 
 template <typename T = double> using tVelocity = tQuantity < tSIUnit < 1, 0, -1, 0, 0, 0, 0 > , T >;
 template <typename T = double> using tAcceleration = tQuantity < tSIUnit < 1, 0, -2, 0, 0, 0, 0 > , T >;
@@ -106,27 +145,27 @@ template <typename T = double, typename TAngleUnit = math::angle::Radian> using
 //----------------------------------------------------------------------
 // Const values
 //----------------------------------------------------------------------
-const double cYOCTO = 1E-24;
-const double cZEPTO = 1E-21;
-const double cATTO = 1E-18;
-const double cFEMTO = 1E-15;
-const double cPICO = 1E-12;
-const double cNANO = 1E-9;
-const double cMICRO = 1E-6;
-const double cMILLI = 1E-3;
-const double cCENTI = 1E-2;
-const double cDECI = 1E-1;
-const double cNO_PREFIX = 1.0;
-const double cDECA = 1E+1;
-const double cHECTO = 1E+2;
-const double cKILO = 1E+3;
-const double cMEGA = 1E+6;
-const double cGIGA = 1E+9;
-const double cTERA = 1E+12;
-const double cPETA = 1E+15;
-const double cEXA = 1E+18;
-const double cZETTA = 1E+21;
-const double cYOTTA = 1E+24;
+constexpr double cYOCTO = 1E-24;
+constexpr double cZEPTO = 1E-21;
+constexpr double cATTO = 1E-18;
+constexpr double cFEMTO = 1E-15;
+constexpr double cPICO = 1E-12;
+constexpr double cNANO = 1E-9;
+constexpr double cMICRO = 1E-6;
+constexpr double cMILLI = 1E-3;
+constexpr double cCENTI = 1E-2;
+constexpr double cDECI = 1E-1;
+constexpr double cNO_PREFIX = 1.0;
+constexpr double cDECA = 1E+1;
+constexpr double cHECTO = 1E+2;
+constexpr double cKILO = 1E+3;
+constexpr double cMEGA = 1E+6;
+constexpr double cGIGA = 1E+9;
+constexpr double cTERA = 1E+12;
+constexpr double cPETA = 1E+15;
+constexpr double cEXA = 1E+18;
+constexpr double cZETTA = 1E+21;
+constexpr double cYOTTA = 1E+24;
 
 //----------------------------------------------------------------------
 // End of namespace declaration
@@ -134,4 +173,10 @@ const double cYOTTA = 1E+24;
 }
 }
 
+// literals and explicit instantiations need the quantity aliases and prefix constants from above
+#define __rrlib__si_units__include_guard__
+#include "rrlib/si_units/literals.h"
+#include "rrlib/si_units/explicit_instantiations.h"
+#undef __rrlib__si_units__include_guard__
+
 #endif
@@ -0,0 +1,211 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tConversionFactorCache.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tConversionFactorCache::cCAPACITY;
+const size_t tConversionFactorCache::cNUMBER_OF_SLOTS;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tConversionFactorCache constructor
+//----------------------------------------------------------------------
+tConversionFactorCache::tConversionFactorCache() :
+  size(0),
+  generation(0),
+  hits(0),
+  misses(0)
+{
+  for (size_t i = 0; i < cNUMBER_OF_SLOTS; ++i)
+  {
+    this->slots[i].store(nullptr, std::memory_order_relaxed);
+  }
+  this->entries.reserve(cCAPACITY);
+}
+
+//----------------------------------------------------------------------
+// tConversionFactorCache Instance
+//----------------------------------------------------------------------
+tConversionFactorCache &tConversionFactorCache::Instance()
+{
+  static tConversionFactorCache instance;
+  return instance;
+}
+
+//----------------------------------------------------------------------
+// tConversionFactorCache SymbolsGeneration
+//----------------------------------------------------------------------
+uint64_t tConversionFactorCache::SymbolsGeneration()
+{
+  return tUserDefinedSymbols::Instance().Generation();
+}
+
+//----------------------------------------------------------------------
+// tConversionFactorCache ScopedSymbolsActive
+//----------------------------------------------------------------------
+bool tConversionFactorCache::ScopedSymbolsActive()
+{
+  return tScopedSymbolContext::Current() != nullptr;
+}
+
+//----------------------------------------------------------------------
+// tConversionFactorCache Hash
+//----------------------------------------------------------------------
+uint64_t tConversionFactorCache::Hash(tDimension dimension, const std::string &symbol_string)
+{
+  // FNV-1a over the symbol, seeded with the packed dimension
+  uint64_t hash = 14695981039346656037ULL ^ (dimension.Packed() * 0x9E3779B97F4A7C15ULL);
+  for (char c : symbol_string)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+//----------------------------------------------------------------------
+// tConversionFactorCache Lookup
+//----------------------------------------------------------------------
+bool tConversionFactorCache::Lookup(tDimension dimension, const std::string &symbol_string, uint64_t generation, double &factor)
+{
+  const uint64_t hash = Hash(dimension, symbol_string);
+  for (size_t i = 0; i < cNUMBER_OF_SLOTS; ++i)
+  {
+    const tEntry *entry = this->slots[(hash + i) % cNUMBER_OF_SLOTS].load(std::memory_order_acquire);
+    if (!entry)
+    {
+      break;
+    }
+    if (entry->hash == hash && entry->generation == generation && entry->dimension == dimension && entry->symbol_string == symbol_string)
+    {
+      factor = entry->factor;
+      this->hits.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  this->misses.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+//----------------------------------------------------------------------
+// tConversionFactorCache Insert
+//----------------------------------------------------------------------
+void tConversionFactorCache::Insert(tDimension dimension, const std::string &symbol_string, uint64_t generation, double factor)
+{
+  const uint64_t hash = Hash(dimension, symbol_string);
+  std::lock_guard<std::mutex> lock(this->insert_mutex);
+  if (generation < this->generation)
+  {
+    return;
+  }
+  if (generation > this->generation)
+  {
+    for (size_t i = 0; i < cNUMBER_OF_SLOTS; ++i)
+    {
+      this->slots[i].store(nullptr, std::memory_order_release);
+    }
+    std::move(this->entries.begin(), this->entries.end(), std::back_inserter(this->retired_entries));
+    this->entries.clear();
+    this->size.store(0, std::memory_order_relaxed);
+    this->generation = generation;
+  }
+  if (this->entries.size() >= cCAPACITY)
+  {
+    return;
+  }
+  for (size_t i = 0; i < cNUMBER_OF_SLOTS; ++i)
+  {
+    std::atomic<const tEntry *> &slot = this->slots[(hash + i) % cNUMBER_OF_SLOTS];
+    const tEntry *entry = slot.load(std::memory_order_relaxed);
+    if (!entry)
+    {
+      this->entries.emplace_back(new tEntry { hash, generation, dimension, symbol_string, factor });
+      slot.store(this->entries.back().get(), std::memory_order_release);
+      this->size.store(this->entries.size(), std::memory_order_relaxed);
+      return;
+    }
+    if (entry->hash == hash && entry->dimension == dimension && entry->symbol_string == symbol_string)
+    {
+      return;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tConversionFactorCache ResetStatistics
+//----------------------------------------------------------------------
+void tConversionFactorCache::ResetStatistics()
+{
+  this->hits.store(0, std::memory_order_relaxed);
+  this->misses.store(0, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
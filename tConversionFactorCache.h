@@ -0,0 +1,207 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tConversionFactorCache.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tConversionFactorCache
+ *
+ * \b tConversionFactorCache
+ *
+ * Process-wide cache of factors to base units for symbol strings.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tConversionFactorCache_h__
+#define __rrlib__si_units__tConversionFactorCache_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tDimension.h"
+#include "rrlib/si_units/tSymbolParser.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Cache for factors to base units
+/*!
+ * Maps (dimension, symbol string) to the factor to the base unit.
+ * Lookups are lock-free: entries are immutable once published to an
+ * open-addressing table of atomic pointers. Insertions are serialized by
+ * a mutex. The number of entries is bounded by cCAPACITY - further
+ * symbols are not cached (and still parsed correctly).
+ *
+ * Entries belong to a generation of the user-defined symbols registry.
+ * The first insertion for a newer generation empties the table. The
+ * replaced entries are kept alive until the cache is destroyed, as
+ * concurrent lookups may still read them.
+ */
+class tConversionFactorCache
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Maximum number of cached symbols */
+  static const size_t cCAPACITY = 1024;
+
+  static tConversionFactorCache &Instance();
+
+  /*!
+   * \return Current generation of the user-defined symbols registry
+   */
+  static uint64_t SymbolsGeneration();
+
+  /*!
+   * \return Whether the current thread has scoped symbol contexts. Parsing then
+   * depends on thread-local symbols, so the process-wide cache must not be used.
+   */
+  static bool ScopedSymbolsActive();
+
+  /*!
+   * \param dimension Dimension of the unit the symbol belongs to
+   * \param symbol_string Symbol string
+   * \param generation Generation of the user-defined symbols the factor must belong to
+   * \param factor Receives the factor if the symbol is cached
+   * \return Whether the symbol was found
+   */
+  bool Lookup(tDimension dimension, const std::string &symbol_string, uint64_t generation, double &factor);
+
+  void Insert(tDimension dimension, const std::string &symbol_string, uint64_t generation, double factor);
+
+  inline size_t Size() const
+  {
+    return this->size.load(std::memory_order_relaxed);
+  }
+
+  inline uint64_t Hits() const
+  {
+    return this->hits.load(std::memory_order_relaxed);
+  }
+
+  inline uint64_t Misses() const
+  {
+    return this->misses.load(std::memory_order_relaxed);
+  }
+
+  void ResetStatistics();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  struct tEntry
+  {
+    uint64_t hash;
+    uint64_t generation;
+    tDimension dimension;
+    std::string symbol_string;
+    double factor;
+  };
+
+  static const size_t cNUMBER_OF_SLOTS = 2 * cCAPACITY;
+
+  std::atomic<const tEntry *> slots[cNUMBER_OF_SLOTS];
+  std::atomic<size_t> size;
+  std::mutex insert_mutex;
+  uint64_t generation;
+  std::vector<std::unique_ptr<tEntry>> entries;
+  std::vector<std::unique_ptr<tEntry>> retired_entries;
+
+  alignas(64) std::atomic<uint64_t> hits;
+  alignas(64) std::atomic<uint64_t> misses;
+
+  tConversionFactorCache();
+
+  static uint64_t Hash(tDimension dimension, const std::string &symbol_string);
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Same as tSymbolParser<TUnit>::GetFactorToBaseUnit, but repeated symbol
+ * strings are served from tConversionFactorCache (one hash and a load).
+ * While a tScopedSymbolContext is active in the calling thread, the cache
+ * is bypassed.
+ *
+ * \param symbol_string String to check
+ * \return Factor to base unit
+ */
+template <typename TUnit>
+double GetCachedFactorToBaseUnit(const std::string &symbol_string)
+{
+  if (tConversionFactorCache::ScopedSymbolsActive())
+  {
+    return tSymbolParser<TUnit>::GetFactorToBaseUnit(symbol_string);
+  }
+  const tDimension dimension = TUnit();
+  const uint64_t generation = tConversionFactorCache::SymbolsGeneration();
+  double factor;
+  if (!tConversionFactorCache::Instance().Lookup(dimension, symbol_string, generation, factor))
+  {
+    factor = tSymbolParser<TUnit>::GetFactorToBaseUnit(symbol_string);
+    tConversionFactorCache::Instance().Insert(dimension, symbol_string, generation, factor);
+  }
+  return factor;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,186 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tDimension.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tDimension
+ *
+ * \b tDimension
+ *
+ * The exponents of the seven basic dimensions packed into one 64 bit word.
+ * This is the runtime counterpart of tSIUnit.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tDimension_h__
+#define __rrlib__si_units__tDimension_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+#include <ostream>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tSIUnit.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Packed exponent vector
+/*!
+ * Byte i of the packed word holds the signed 8 bit exponent of basic
+ * dimension i (in the order of the tSIUnit template parameters).
+ * Equality is a single integer compare, multiplication and division
+ * add and subtract all exponents at once without carries between lanes.
+ */
+class tDimension
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  constexpr tDimension()
+    : packed(0)
+  {}
+
+  constexpr explicit tDimension(uint64_t packed)
+    : packed(packed)
+  {}
+
+  template <int Tlength, int Tmass, int Ttime, int Telectric_current, int Ttemperature, int Tamount_of_substance, int Tluminous_intensity>
+  constexpr tDimension(tSIUnit<Tlength, Tmass, Ttime, Telectric_current, Ttemperature, Tamount_of_substance, Tluminous_intensity>)
+    : packed(Pack(Tlength, 0) | Pack(Tmass, 1) | Pack(Ttime, 2) | Pack(Telectric_current, 3) | Pack(Ttemperature, 4) | Pack(Tamount_of_substance, 5) | Pack(Tluminous_intensity, 6))
+  {}
+
+  explicit tDimension(const int *exponents)
+    : packed(0)
+  {
+    for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
+    {
+      this->packed |= Pack(exponents[i], i);
+    }
+  }
+
+  inline constexpr uint64_t Packed() const
+  {
+    return this->packed;
+  }
+
+  inline constexpr int Exponent(size_t index) const
+  {
+    return static_cast<int8_t>(static_cast<uint8_t>(this->packed >> (8 * index)));
+  }
+
+  inline void GetExponents(int *exponents) const
+  {
+    for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
+    {
+      exponents[i] = this->Exponent(i);
+    }
+  }
+
+  inline constexpr bool IsDimensionless() const
+  {
+    return this->packed == 0;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  uint64_t packed;
+
+  static constexpr uint64_t Pack(int exponent, size_t index)
+  {
+    return static_cast<uint64_t>(static_cast<uint8_t>(exponent)) << (8 * index);
+  }
+
+};
+
+//----------------------------------------------------------------------
+// Operators
+//----------------------------------------------------------------------
+namespace internal
+{
+const uint64_t cDIMENSION_HIGH_BITS = 0x8080808080808080ULL;
+}
+
+inline constexpr bool operator == (tDimension left, tDimension right)
+{
+  return left.Packed() == right.Packed();
+}
+
+inline constexpr bool operator != (tDimension left, tDimension right)
+{
+  return left.Packed() != right.Packed();
+}
+
+inline constexpr tDimension operator * (tDimension left, tDimension right)
+{
+  return tDimension(((left.Packed() & ~internal::cDIMENSION_HIGH_BITS) + (right.Packed() & ~internal::cDIMENSION_HIGH_BITS)) ^ ((left.Packed() ^ right.Packed()) & internal::cDIMENSION_HIGH_BITS));
+}
+
+inline constexpr tDimension operator / (tDimension left, tDimension right)
+{
+  return tDimension(((left.Packed() | internal::cDIMENSION_HIGH_BITS) - (right.Packed() & ~internal::cDIMENSION_HIGH_BITS)) ^ ((left.Packed() ^ ~right.Packed()) & internal::cDIMENSION_HIGH_BITS));
+}
+
+inline std::ostream &operator << (std::ostream &stream, tDimension dimension)
+{
+  int exponents[cNUMBER_OF_BASIC_DIMENSIONS];
+  dimension.GetExponents(exponents);
+  return WriteSymbolFromExponentList(stream, exponents);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,270 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tDynamicQuantity.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tDynamicQuantity
+ *
+ * \b tDynamicQuantity
+ *
+ * A quantity whose unit is only known at runtime. Used at plugin, scripting
+ * and configuration boundaries where the static type of a tQuantity is lost.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tDynamicQuantity_h__
+#define __rrlib__si_units__tDynamicQuantity_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <stdexcept>
+#include <sstream>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tDimension.h"
+#include "rrlib/si_units/tQuantity.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Runtime-dimensioned quantity
+/*!
+ * Holds a value in base units together with its tDimension.
+ * Additive operations and conversions to a static tQuantity throw
+ * a std::runtime_error if the dimensions do not match.
+ */
+class tDynamicQuantity
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tDynamicQuantity()
+    : value(0)
+  {}
+
+  tDynamicQuantity(double value, tDimension dimension)
+    : value(value),
+      dimension(dimension)
+  {}
+
+  template <typename TUnit, typename TValue>
+  tDynamicQuantity(tQuantity<TUnit, TValue> quantity)
+    : value(static_cast<double>(quantity.Value())),
+      dimension(TUnit())
+  {}
+
+  template <typename TQuantity>
+  TQuantity To() const
+  {
+    CheckDimension(tDimension(typename TQuantity::tUnit()));
+    return TQuantity(typename TQuantity::tValue(this->value));
+  }
+
+  inline double Value() const
+  {
+    return this->value;
+  }
+
+  inline tDimension Dimension() const
+  {
+    return this->dimension;
+  }
+
+  tDynamicQuantity &operator += (tDynamicQuantity other)
+  {
+    this->CheckDimension(other.dimension);
+    this->value += other.value;
+    return *this;
+  }
+
+  tDynamicQuantity &operator -= (tDynamicQuantity other)
+  {
+    this->CheckDimension(other.dimension);
+    this->value -= other.value;
+    return *this;
+  }
+
+  inline void CheckDimension(tDimension expected) const
+  {
+    if (this->dimension != expected)
+    {
+      std::ostringstream message;
+      message << "Dimension mismatch: '" << this->dimension << "' is not '" << expected << "'";
+      throw std::runtime_error(message.str());
+    }
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  double value;
+  tDimension dimension;
+
+};
+
+//----------------------------------------------------------------------
+// Arithmetic
+//----------------------------------------------------------------------
+inline tDynamicQuantity operator - (tDynamicQuantity value)
+{
+  return tDynamicQuantity(-value.Value(), value.Dimension());
+}
+
+inline tDynamicQuantity operator + (tDynamicQuantity left, tDynamicQuantity right)
+{
+  left += right;
+  return left;
+}
+
+inline tDynamicQuantity operator - (tDynamicQuantity left, tDynamicQuantity right)
+{
+  left -= right;
+  return left;
+}
+
+inline tDynamicQuantity operator * (tDynamicQuantity left, tDynamicQuantity right)
+{
+  return tDynamicQuantity(left.Value() * right.Value(), left.Dimension() * right.Dimension());
+}
+
+inline tDynamicQuantity operator * (tDynamicQuantity quantity, double scalar)
+{
+  return tDynamicQuantity(quantity.Value() * scalar, quantity.Dimension());
+}
+
+inline tDynamicQuantity operator * (double scalar, tDynamicQuantity quantity)
+{
+  return quantity * scalar;
+}
+
+inline tDynamicQuantity operator / (tDynamicQuantity left, tDynamicQuantity right)
+{
+  return tDynamicQuantity(left.Value() / right.Value(), left.Dimension() / right.Dimension());
+}
+
+inline tDynamicQuantity operator / (tDynamicQuantity quantity, double scalar)
+{
+  return tDynamicQuantity(quantity.Value() / scalar, quantity.Dimension());
+}
+
+inline tDynamicQuantity operator / (double scalar, tDynamicQuantity quantity)
+{
+  return tDynamicQuantity(scalar / quantity.Value(), tDimension() / quantity.Dimension());
+}
+
+//----------------------------------------------------------------------
+// Comparison
+//----------------------------------------------------------------------
+inline const bool operator == (tDynamicQuantity left, tDynamicQuantity right)
+{
+  return left.Dimension() == right.Dimension() && left.Value() == right.Value();
+}
+
+inline const bool operator != (tDynamicQuantity left, tDynamicQuantity right)
+{
+  return !(left == right);
+}
+
+inline const bool operator < (tDynamicQuantity left, tDynamicQuantity right)
+{
+  left.CheckDimension(right.Dimension());
+  return left.Value() < right.Value();
+}
+
+inline const bool operator > (tDynamicQuantity left, tDynamicQuantity right)
+{
+  return right < left;
+}
+
+inline const bool operator <= (tDynamicQuantity left, tDynamicQuantity right)
+{
+  return !(left > right);
+}
+
+inline const bool operator >= (tDynamicQuantity left, tDynamicQuantity right)
+{
+  return !(left < right);
+}
+
+//----------------------------------------------------------------------
+// Streaming
+//----------------------------------------------------------------------
+inline std::ostream &operator << (std::ostream &stream, tDynamicQuantity quantity)
+{
+  stream << quantity.Value() << " " << quantity.Dimension();
+  return stream;
+}
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+inline serialization::tOutputStream& operator << (serialization::tOutputStream &stream, tDynamicQuantity quantity)
+{
+  stream << quantity.Dimension().Packed() << quantity.Value();
+  return stream;
+}
+
+inline serialization::tInputStream& operator >> (serialization::tInputStream &stream, tDynamicQuantity &quantity)
+{
+  uint64_t packed;
+  double value;
+  stream >> packed >> value;
+  quantity = tDynamicQuantity(value, tDimension(packed));
+  return stream;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,130 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tMemoryMappedFile.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tMemoryMappedFile constructor
+//----------------------------------------------------------------------
+tMemoryMappedFile::tMemoryMappedFile(const std::string &file_name) :
+  data(nullptr),
+  size(0)
+{
+  int file_descriptor = open(file_name.c_str(), O_RDONLY);
+  if (file_descriptor < 0)
+  {
+    this->error_message = "Could not open '" + file_name + "': " + std::strerror(errno);
+    return;
+  }
+
+  struct stat file_status;
+  if (fstat(file_descriptor, &file_status) != 0)
+  {
+    this->error_message = "Could not stat '" + file_name + "': " + std::strerror(errno);
+    close(file_descriptor);
+    return;
+  }
+
+  this->size = file_status.st_size;
+  if (this->size > 0)
+  {
+    void *address = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (address == MAP_FAILED)
+    {
+      this->error_message = "Could not map '" + file_name + "': " + std::strerror(errno);
+      this->size = 0;
+    }
+    else
+    {
+      this->data = static_cast<const char *>(address);
+      madvise(address, this->size, MADV_SEQUENTIAL);
+    }
+  }
+  close(file_descriptor);
+}
+
+//----------------------------------------------------------------------
+// tMemoryMappedFile destructor
+//----------------------------------------------------------------------
+tMemoryMappedFile::~tMemoryMappedFile()
+{
+  if (this->data)
+  {
+    munmap(const_cast<char *>(this->data), this->size);
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,126 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tMemoryMappedFile.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tMemoryMappedFile
+ *
+ * \b tMemoryMappedFile
+ *
+ * Read-only memory mapping of a whole file (POSIX mmap)
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tMemoryMappedFile_h__
+#define __rrlib__si_units__tMemoryMappedFile_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Read-only memory mapped file
+/*!
+ * Maps a whole file into memory for the lifetime of this object.
+ * If the file cannot be opened or mapped, IsOpen() returns false
+ * and ErrorMessage() describes the reason.
+ */
+class tMemoryMappedFile
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  explicit tMemoryMappedFile(const std::string &file_name);
+
+  ~tMemoryMappedFile();
+
+  tMemoryMappedFile(const tMemoryMappedFile &) = delete;
+  tMemoryMappedFile &operator = (const tMemoryMappedFile &) = delete;
+
+  inline bool IsOpen() const
+  {
+    return this->error_message.empty();
+  }
+
+  inline const std::string &ErrorMessage() const
+  {
+    return this->error_message;
+  }
+
+  inline const char *Data() const
+  {
+    return this->data;
+  }
+
+  inline size_t Size() const
+  {
+    return this->size;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  const char *data;
+  size_t size;
+  std::string error_message;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
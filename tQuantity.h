@@ -52,6 +52,8 @@
 //----------------------------------------------------------------------
 #include "rrlib/si_units/operators/tProduct.h"
 #include "rrlib/si_units/operators/tQuotient.h"
+#include "rrlib/si_units/engineering_notation.h"
+#include "rrlib/si_units/operation_counters.h"
 
 #ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
 #include "rrlib/serialization/serialization.h"
@@ -73,8 +75,88 @@ namespace si_units
 //----------------------------------------------------------------------
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
+RRLIB_SI_UNITS_BEGIN_QUANTITY_NAMESPACE
 template <typename TUnit, typename TValue = double>
 class tQuantity;
+RRLIB_SI_UNITS_END_QUANTITY_NAMESPACE
+
+namespace internal
+{
+/*!
+ * Converts a std::chrono::duration to a count of seconds in TValue.
+ * The period ratio is folded at compile time so that integral TValue
+ * take an exact integer path (no-op for equal periods) and never go
+ * through an intermediate double. Conversions that would truncate
+ * (e.g. milliseconds to integral seconds) do not compile.
+ */
+template <typename TValue, typename TRep, typename TPeriod>
+inline TValue DurationToSeconds(std::chrono::duration<TRep, TPeriod> duration)
+{
+  static_assert(std::chrono::treat_as_floating_point<TValue>::value || std::ratio_divide<TPeriod, std::ratio<1>>::den == 1,
+                "Duration cannot be represented exactly in integral seconds. Use duration_cast or a floating point value type.");
+  return std::chrono::duration<TValue>(duration).count();
+}
+
+/*!
+ * Value type used to represent a std::chrono::duration with period TPeriod in
+ * arithmetic with quantities of value type TValue. Integral value types are
+ * only used if the duration is a whole number of seconds, otherwise (and for
+ * non-arithmetic value types like angles) double is used.
+ */
+template <typename TValue, typename TPeriod>
+struct tDurationValue
+{
+  typedef typename std::conditional < std::is_floating_point<TValue>::value || (std::is_integral<TValue>::value && std::ratio_divide<TPeriod, std::ratio<1>>::den == 1), TValue, double >::type tType;
+};
+
+/*!
+ * Whether TValue is a SIMD type (e.g. std::experimental::simd or a GCC vector extension type),
+ * i.e. its comparisons yield a mask instead of bool
+ */
+template <typename TValue, typename = void>
+struct tIsVectorValue
+{
+  static const bool cVALUE = false;
+};
+
+template <typename TValue>
+struct tIsVectorValue<TValue, decltype(void(std::declval<TValue>() == std::declval<TValue>()))>
+{
+  static const bool cVALUE = !std::is_same<decltype(std::declval<TValue>() == std::declval<TValue>()), bool>::value;
+};
+
+/*!
+ * Element-wise selection: mask ? if_true : if_false.
+ * Uses where() of std::experimental::simd if found by ADL, the conditional operator otherwise
+ * (which also handles bool and GCC vector extension masks).
+ */
+template <typename TMask, typename TValue>
+inline auto SelectValue(const TMask &mask, const TValue &if_true, const TValue &if_false, int) -> decltype(where(mask, std::declval<TValue &>()) = if_true, TValue())
+{
+  TValue result = if_false;
+  where(mask, result) = if_true;
+  return result;
+}
+
+template <typename TMask, typename TValue>
+inline auto SelectValue(const TMask &mask, const TValue &if_true, const TValue &if_false, long) -> decltype(mask ? if_true : if_false)
+{
+  return mask ? if_true : if_false;
+}
+
+template <typename TLeftValue, typename TRightValue>
+inline auto IsEqualValues(const TLeftValue &a, const TRightValue &b, float max_error, math::tFloatComparisonMethod method, std::false_type) -> decltype(math::IsEqual(a, b, max_error, method))
+{
+  return math::IsEqual(a, b, max_error, method);
+}
+
+template <typename TLeftValue, typename TRightValue>
+inline auto IsEqualValues(const TLeftValue &a, const TRightValue &b, float max_error, math::tFloatComparisonMethod method, std::true_type) -> decltype((a - b <= max_error) && (b - a <= max_error))
+{
+  assert(method == math::eFCM_ABSOLUTE_ERROR && "SIMD values only support comparison with absolute error");
+  return (a - b <= max_error) && (b - a <= max_error);
+}
+}
 
 //----------------------------------------------------------------------
 // Class declaration
@@ -82,6 +164,7 @@ class tQuantity;
 class tQuantityBase
 {};
 
+RRLIB_SI_UNITS_BEGIN_QUANTITY_NAMESPACE
 //!
 /*!
  *
@@ -98,19 +181,18 @@ public:
   typedef tSIUnit<Tlength, Tmass, Ttime, Telectric_current, Ttemperature, Tamount_of_substance, Tluminous_intensity> tUnit;
   typedef TValue tValue;
 
-  tQuantity()
-  {
-    std::memset(this, 0, sizeof(tQuantity));
-  }
+  constexpr tQuantity()
+    : value()
+  {}
 
   template < typename T, typename = typename std::enable_if < !std::is_base_of<tQuantityBase, T>::value, decltype(TValue(T())) >::type >
-  tQuantity(T value)
+  constexpr tQuantity(T value)
     : value(TValue(value))
   {}
 
   template <typename TRep, typename TPeriod, typename = typename std::enable_if <std::is_same<tUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::value, TRep>::type>
   tQuantity(std::chrono::duration<TRep, TPeriod> duration)
-    : value(std::chrono::duration<TValue>(duration).count())
+    : value(internal::DurationToSeconds<TValue>(duration))
   {}
 
   template <typename TOtherValue>
@@ -137,19 +219,21 @@ public:
     return std::chrono::duration_cast<std::chrono::duration<TRep, TPeriod>>(std::chrono::duration<TValue>(this->value));
   }
 
-  inline TValue Value() const
+  inline constexpr TValue Value() const
   {
     return this->value;
   }
 
   tQuantity operator += (tQuantity other)
   {
+    RRLIB_SI_UNITS_COUNT_OPERATION(eAO_ADD, tUnit, tUnit);
     this->value += other.value;
     return *this;
   }
 
   tQuantity operator -= (tQuantity other)
   {
+    RRLIB_SI_UNITS_COUNT_OPERATION(eAO_SUBTRACT, tUnit, tUnit);
     this->value -= other.value;
     return *this;
   }
@@ -162,6 +246,7 @@ private:
   TValue value;
 
 };
+RRLIB_SI_UNITS_END_QUANTITY_NAMESPACE
 
 //----------------------------------------------------------------------
 // Unary minus
@@ -186,7 +271,7 @@ tQuantity < TUnit, decltype(TLeftValue() + TRightValue()) > operator + (tQuantit
 template <typename TValue, typename TRep, typename TPeriod>
 tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> operator + (tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> time, std::chrono::duration<TRep, TPeriod> duration)
 {
-  return time + tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, double>(std::chrono::duration<double>(duration));
+  return time + tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, typename internal::tDurationValue<TValue, TPeriod>::tType>(duration);
 }
 template <typename TValue, typename TRep, typename TPeriod>
 tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> operator + (std::chrono::duration<TRep, TPeriod> duration, tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> time)
@@ -208,12 +293,12 @@ tQuantity < TUnit, decltype(TLeftValue() - TRightValue()) > operator - (tQuantit
 template <typename TValue, typename TRep, typename TPeriod>
 tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> operator - (tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> time, std::chrono::duration<TRep, TPeriod> duration)
 {
-  return time - tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, double>(std::chrono::duration<double>(duration));
+  return time - tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, typename internal::tDurationValue<TValue, TPeriod>::tType>(duration);
 }
 template <typename TValue, typename TRep, typename TPeriod>
 tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> operator - (std::chrono::duration<TRep, TPeriod> duration, tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> time)
 {
-  return tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, double>(std::chrono::duration<double>(duration)) - time;
+  return tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, typename internal::tDurationValue<TValue, TPeriod>::tType>(duration) - time;
 }
 
 //----------------------------------------------------------------------
@@ -222,12 +307,14 @@ tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> operator - (std::chrono::duratio
 template <typename TLeftUnit, typename TRightUnit, typename TLeftValue, typename TRightValue>
 tQuantity<typename operators::tProduct<TLeftUnit, TRightUnit>::tResult, decltype(TLeftValue() * TRightValue())> operator *(tQuantity<TLeftUnit, TLeftValue> left, tQuantity<TRightUnit, TRightValue> right)
 {
+  RRLIB_SI_UNITS_COUNT_OPERATION(eAO_MULTIPLY, TLeftUnit, TRightUnit);
   return tQuantity<typename operators::tProduct<TLeftUnit, TRightUnit>::tResult, decltype(TLeftValue() * TRightValue())>(left.Value() * right.Value());
 }
 
 template <typename TUnit, typename TValue, typename TScalar>
 tQuantity<TUnit, decltype(TValue() * TScalar())> operator *(tQuantity<TUnit, TValue> quantity, TScalar scalar)
 {
+  RRLIB_SI_UNITS_COUNT_OPERATION(eAO_MULTIPLY, TUnit, tSIUnit<0, 0, 0, 0, 0, 0, 0>);
   return tQuantity<TUnit, decltype(TValue() * TScalar())>(quantity.Value() * scalar);
 }
 template <typename TUnit, typename TValue, typename TScalar>
@@ -239,7 +326,7 @@ tQuantity<TUnit, decltype(TValue() * TScalar())> operator *(TScalar scalar, tQua
 template <typename TUnit, typename TValue, typename TRep, typename TPeriod>
 tQuantity<typename operators::tProduct<TUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tResult, TValue> operator *(tQuantity<TUnit, TValue> quantity, std::chrono::duration<TRep, TPeriod> duration)
 {
-  return quantity * tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, double>(std::chrono::duration<double>(duration));
+  return quantity * tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, typename internal::tDurationValue<TValue, TPeriod>::tType>(duration);
 }
 template <typename TUnit, typename TValue, typename TRep, typename TPeriod>
 tQuantity<typename operators::tProduct<TUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tResult, TValue> operator *(std::chrono::duration<TRep, TPeriod> duration, tQuantity<TUnit, TValue> quantity)
@@ -253,24 +340,41 @@ tQuantity<typename operators::tProduct<TUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tRe
 template <typename TLeftUnit, typename TRightUnit, typename TLeftValue, typename TRightValue>
 tQuantity < typename operators::tQuotient<TLeftUnit, TRightUnit>::tResult, decltype(TLeftValue() / TRightValue()) > operator / (tQuantity<TLeftUnit, TLeftValue> left, tQuantity<TRightUnit, TRightValue> right)
 {
+  RRLIB_SI_UNITS_COUNT_OPERATION(eAO_DIVIDE, TLeftUnit, TRightUnit);
   return tQuantity < typename operators::tQuotient<TLeftUnit, TRightUnit>::tResult, decltype(TLeftValue() / TRightValue()) > (left.Value() / right.Value());
 }
 
 template <typename TUnit, typename TValue>
-tQuantity < TUnit, decltype(TValue() / double()) > operator /(tQuantity<TUnit, TValue> quantity, double scalar)
+typename std::enable_if < !internal::tIsVectorValue<TValue>::cVALUE, tQuantity < TUnit, decltype(TValue() / double()) > >::type operator /(tQuantity<TUnit, TValue> quantity, double scalar)
 {
-  return quantity / tQuantity<tSIUnit<0, 0, 0, 0, 0, 0, 0>>(scalar);
+  RRLIB_SI_UNITS_COUNT_OPERATION(eAO_DIVIDE, TUnit, tSIUnit<0, 0, 0, 0, 0, 0, 0>);
+  return tQuantity < TUnit, decltype(TValue() / double()) > (quantity.Value() / scalar);
 }
 template <typename TUnit, typename TValue>
-tQuantity < typename operators::tQuotient<tSIUnit<0, 0, 0, 0, 0, 0, 0>, TUnit>::tResult, decltype(double() / TValue()) > operator /(double scalar, tQuantity<TUnit, TValue> quantity)
+typename std::enable_if < !internal::tIsVectorValue<TValue>::cVALUE, tQuantity < typename operators::tQuotient<tSIUnit<0, 0, 0, 0, 0, 0, 0>, TUnit>::tResult, decltype(double() / TValue()) > >::type operator /(double scalar, tQuantity<TUnit, TValue> quantity)
 {
-  return tQuantity<tSIUnit<0, 0, 0, 0, 0, 0, 0>>(scalar) / quantity;
+  RRLIB_SI_UNITS_COUNT_OPERATION(eAO_DIVIDE, tSIUnit<0, 0, 0, 0, 0, 0, 0>, TUnit);
+  return tQuantity < typename operators::tQuotient<tSIUnit<0, 0, 0, 0, 0, 0, 0>, TUnit>::tResult, decltype(double() / TValue()) > (scalar / quantity.Value());
+}
+
+// SIMD value types are divided by their element type (e.g. float) to avoid the conversion to double
+template <typename TUnit, typename TValue, typename TScalar>
+typename std::enable_if < internal::tIsVectorValue<TValue>::cVALUE && !std::is_base_of<tQuantityBase, TScalar>::value, tQuantity < TUnit, decltype(TValue() / TScalar()) > >::type operator /(tQuantity<TUnit, TValue> quantity, TScalar scalar)
+{
+  RRLIB_SI_UNITS_COUNT_OPERATION(eAO_DIVIDE, TUnit, tSIUnit<0, 0, 0, 0, 0, 0, 0>);
+  return tQuantity < TUnit, decltype(TValue() / TScalar()) > (quantity.Value() / scalar);
+}
+template <typename TUnit, typename TValue, typename TScalar>
+typename std::enable_if < internal::tIsVectorValue<TValue>::cVALUE && !std::is_base_of<tQuantityBase, TScalar>::value, tQuantity < typename operators::tQuotient<tSIUnit<0, 0, 0, 0, 0, 0, 0>, TUnit>::tResult, decltype(TScalar() / TValue()) > >::type operator /(TScalar scalar, tQuantity<TUnit, TValue> quantity)
+{
+  RRLIB_SI_UNITS_COUNT_OPERATION(eAO_DIVIDE, tSIUnit<0, 0, 0, 0, 0, 0, 0>, TUnit);
+  return tQuantity < typename operators::tQuotient<tSIUnit<0, 0, 0, 0, 0, 0, 0>, TUnit>::tResult, decltype(TScalar() / TValue()) > (scalar / quantity.Value());
 }
 
 template <typename TUnit, typename TValue, typename TRep, typename TPeriod>
 tQuantity<typename operators::tQuotient<TUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tResult, TValue> operator /(tQuantity<TUnit, TValue> quantity, std::chrono::duration<TRep, TPeriod> duration)
 {
-  return quantity / tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, double>(std::chrono::duration<double>(duration));
+  return quantity / tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, typename internal::tDurationValue<TValue, TPeriod>::tType>(duration);
 }
 template <typename TUnit, typename TValue, typename TRep, typename TPeriod>
 tQuantity<typename operators::tQuotient<TUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tResult, TValue> operator /(std::chrono::duration<TRep, TPeriod> duration, tQuantity<TUnit, TValue> quantity)
@@ -281,46 +385,61 @@ tQuantity<typename operators::tQuotient<TUnit, tSIUnit<0, 0, 1, 0, 0, 0, 0>>::tR
 //----------------------------------------------------------------------
 // Comparison
 //----------------------------------------------------------------------
+// For SIMD value types the comparisons return masks
 template <typename TUnit, typename TLeftValue, typename TRightValue>
-const bool operator == (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right)
+auto operator == (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right) -> decltype(left.Value() == right.Value())
 {
   return left.Value() == right.Value();
 }
 
 template <typename TUnit, typename TLeftValue, typename TRightValue>
-const bool operator != (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right)
+auto operator != (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right) -> decltype(left.Value() != right.Value())
 {
-  return !(left == right);
+  return left.Value() != right.Value();
 }
 
 template <typename TUnit, typename TLeftValue, typename TRightValue>
-const bool operator < (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right)
+auto operator < (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right) -> decltype(left.Value() < right.Value())
 {
   return left.Value() < right.Value();
 }
 
 template <typename TUnit, typename TLeftValue, typename TRightValue>
-const bool operator > (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right)
+auto operator > (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right) -> decltype(left.Value() > right.Value())
 {
   return left.Value() > right.Value();
 }
 
 template <typename TUnit, typename TLeftValue, typename TRightValue>
-const bool operator <= (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right)
+auto operator <= (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right) -> decltype(left.Value() <= right.Value())
 {
-  return !(left > right);
+  return left.Value() <= right.Value();
 }
 
 template <typename TUnit, typename TLeftValue, typename TRightValue>
-const bool operator >= (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right)
+auto operator >= (tQuantity<TUnit, TLeftValue> left, tQuantity<TUnit, TRightValue> right) -> decltype(left.Value() >= right.Value())
 {
-  return !(left < right);
+  return left.Value() >= right.Value();
 }
 
 template <typename TUnit, typename TLeftValue, typename TRightValue>
-const bool IsEqual(tQuantity<TUnit, TLeftValue> a, tQuantity<TUnit, TRightValue> b, float max_error = 1.0E-6, math::tFloatComparisonMethod method = math::eFCM_ABSOLUTE_ERROR)
+auto IsEqual(tQuantity<TUnit, TLeftValue> a, tQuantity<TUnit, TRightValue> b, float max_error = 1.0E-6, math::tFloatComparisonMethod method = math::eFCM_ABSOLUTE_ERROR)
+-> decltype(internal::IsEqualValues(a.Value(), b.Value(), max_error, method, std::integral_constant<bool, internal::tIsVectorValue<TLeftValue>::cVALUE>()))
 {
-  return IsEqual(a.Value(), b.Value(), max_error, method);
+  return internal::IsEqualValues(a.Value(), b.Value(), max_error, method, std::integral_constant<bool, internal::tIsVectorValue<TLeftValue>::cVALUE>());
+}
+
+//----------------------------------------------------------------------
+// Selection
+//----------------------------------------------------------------------
+/*!
+ * Where-style selection that keeps the unit: element-wise mask ? if_true : if_false.
+ * mask is bool for scalar value types and the result of a comparison for SIMD value types.
+ */
+template <typename TMask, typename TUnit, typename TValue>
+tQuantity<TUnit, TValue> Select(const TMask &mask, tQuantity<TUnit, TValue> if_true, tQuantity<TUnit, TValue> if_false)
+{
+  return tQuantity<TUnit, TValue>(internal::SelectValue(mask, if_true.Value(), if_false.Value(), 0));
 }
 
 //----------------------------------------------------------------------
@@ -329,21 +448,24 @@ const bool IsEqual(tQuantity<TUnit, TLeftValue> a, tQuantity<TUnit, TRightValue>
 template <typename TUnit, typename TValue>
 std::ostream &operator << (std::ostream &stream, tQuantity<TUnit, TValue> quantity)
 {
-  stream << quantity.Value() << " " << TUnit();
+  if (!internal::TryWriteEngineeringNotation<TUnit>(stream, quantity.Value(), std::is_arithmetic<TValue>()))
+  {
+    stream << quantity.Value() << " " << TUnit();
+  }
   return stream;
 }
 
 #ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
 
 template <typename TUnit, typename TValue>
-inline serialization::tOutputStream& operator << (serialization::tOutputStream &stream, tQuantity<TUnit, TValue> quantity)
+serialization::tOutputStream& operator << (serialization::tOutputStream &stream, tQuantity<TUnit, TValue> quantity)
 {
   stream << quantity.Value();
   return stream;
 }
 
 template <typename TUnit, typename TValue>
-inline serialization::tInputStream& operator >> (serialization::tInputStream &stream, tQuantity<TUnit, TValue> &quantity)
+serialization::tInputStream& operator >> (serialization::tInputStream &stream, tQuantity<TUnit, TValue> &quantity)
 {
   TValue value;
   stream >> value;
@@ -352,7 +474,7 @@ inline serialization::tInputStream& operator >> (serialization::tInputStream &st
 }
 
 template <typename TUnit, typename TValue>
-inline serialization::tStringOutputStream &operator << (serialization::tStringOutputStream &stream, tQuantity<TUnit, TValue> quantity)
+serialization::tStringOutputStream &operator << (serialization::tStringOutputStream &stream, tQuantity<TUnit, TValue> quantity)
 {
   std::stringstream str;
   str << quantity;
@@ -361,12 +483,12 @@ inline serialization::tStringOutputStream &operator << (serialization::tStringOu
 }
 
 template <typename TUnit, typename TValue>
-inline serialization::tStringInputStream &operator >> (serialization::tStringInputStream &stream, tQuantity<TUnit, TValue> &quantity)
+serialization::tStringInputStream &operator >> (serialization::tStringInputStream &stream, tQuantity<TUnit, TValue> &quantity)
 {
   TValue value;
   stream.GetWrappedStringStream() >> value;
   std::string symbol_string = stream.ReadWhile("/^", serialization::tStringInputStream::cWHITESPACE | serialization::tStringInputStream::cLETTER | serialization::tStringInputStream::cDIGIT, true);
-  double factor = symbol_string.length() ? tSymbolParser<TUnit>::GetFactorToBaseUnit(symbol_string) : 1;
+  double factor = symbol_string.length() ? GetCachedFactorToBaseUnit<TUnit>(symbol_string) : 1;
   quantity = tQuantity<TUnit, TValue>(static_cast<TValue>(factor * value));
   return stream;
 }
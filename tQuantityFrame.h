@@ -0,0 +1,337 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tQuantityFrame.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tQuantityFrame
+ *
+ * \b tQuantityFrame
+ *
+ * Column-wise storage of frames (records) of heterogeneous quantities.
+ * The schema is a list of field types derived from tField, e.g.
+ *
+ *   struct tStamp : tField<tTime<>> { static const char *Name() { return "stamp"; } };
+ *   struct tForceX : tField<tForce<>> { static const char *Name() { return "force_x"; } };
+ *   tQuantityFrame<tStamp, tForceX> frames;
+ *
+ * Every field is stored in its own contiguous column, so scanning one
+ * field only touches the memory of that field.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tQuantityFrame_h__
+#define __rrlib__si_units__tQuantityFrame_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tQuantity.h"
+#include "rrlib/si_units/tSerializationTag.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*!
+ * Base of field declarations for tQuantityFrame.
+ * Derived types name the field and provide a static Name() used for serialization.
+ */
+template <typename TQuantity>
+struct tField
+{
+  typedef TQuantity tQuantityType;
+};
+
+namespace internal
+{
+
+template <typename TField, typename ... TFields>
+struct tFieldIndex;
+
+template <typename TField, typename ... TFields>
+struct tFieldIndex<TField, TField, TFields...>
+{
+  static const size_t cVALUE = 0;
+};
+
+template <typename TField, typename TOther, typename ... TFields>
+struct tFieldIndex<TField, TOther, TFields...>
+{
+  static const size_t cVALUE = 1 + tFieldIndex<TField, TFields...>::cVALUE;
+};
+
+template <typename TField>
+struct tFieldIndex<TField>
+{
+  static_assert(sizeof(TField) == 0, "Field is not part of the frame schema");
+};
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Column-wise frames of quantities
+/*!
+ * Stores Size() frames with one quantity per field in TFields.
+ * Columns are accessed by field type; rows are accessed through lightweight views.
+ */
+template <typename ... TFields>
+class tQuantityFrame
+{
+
+  static_assert(sizeof...(TFields) > 0, "A frame needs at least one field");
+
+  typedef std::tuple<std::vector<typename TFields::tQuantityType>...> tColumns;
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  template <typename TField>
+  using tColumn = std::vector<typename TField::tQuantityType>;
+
+  //! One frame as a value (e.g. for handing frames between threads through a tRingBuffer)
+  typedef std::tuple<typename TFields::tQuantityType...> tRecord;
+
+  //! View of one row of a (mutable) frame
+  class tRow
+  {
+  public:
+    tRow(tQuantityFrame &frame, size_t index) : frame(frame), index(index) {}
+
+    template <typename TField>
+    inline typename TField::tQuantityType &Get() const
+    {
+      return this->frame.template Column<TField>()[this->index];
+    }
+
+  private:
+    tQuantityFrame &frame;
+    size_t index;
+  };
+
+  //! View of one row of a constant frame
+  class tConstRow
+  {
+  public:
+    tConstRow(const tQuantityFrame &frame, size_t index) : frame(frame), index(index) {}
+
+    template <typename TField>
+    inline const typename TField::tQuantityType &Get() const
+    {
+      return this->frame.template Column<TField>()[this->index];
+    }
+
+  private:
+    const tQuantityFrame &frame;
+    size_t index;
+  };
+
+  static const size_t cNUMBER_OF_FIELDS = sizeof...(TFields);
+
+  tQuantityFrame()
+  {}
+
+  explicit tQuantityFrame(size_t size)
+  {
+    this->Resize(size);
+  }
+
+  inline size_t Size() const
+  {
+    return std::get<0>(this->columns).size();
+  }
+
+  inline bool Empty() const
+  {
+    return this->Size() == 0;
+  }
+
+  void Resize(size_t size)
+  {
+    int expand[] = { (this->Column<TFields>().resize(size), 0)... };
+    (void)expand;
+  }
+
+  void Reserve(size_t size)
+  {
+    int expand[] = { (this->Column<TFields>().reserve(size), 0)... };
+    (void)expand;
+  }
+
+  void Clear()
+  {
+    int expand[] = { (this->Column<TFields>().clear(), 0)... };
+    (void)expand;
+  }
+
+  /*!
+   * Appends one frame with one value per field (in schema order)
+   */
+  void Append(typename TFields::tQuantityType... values)
+  {
+    int expand[] = { (this->Column<TFields>().push_back(values), 0)... };
+    (void)expand;
+  }
+
+  void Append(const tRecord &record)
+  {
+    int expand[] = { (this->Column<TFields>().push_back(std::get<internal::tFieldIndex<TFields, TFields...>::cVALUE>(record)), 0)... };
+    (void)expand;
+  }
+
+  inline tRecord Record(size_t index) const
+  {
+    return tRecord(this->Column<TFields>()[index]...);
+  }
+
+  template <typename TField>
+  inline tColumn<TField> &Column()
+  {
+    return std::get<internal::tFieldIndex<TField, TFields...>::cVALUE>(this->columns);
+  }
+
+  template <typename TField>
+  inline const tColumn<TField> &Column() const
+  {
+    return std::get<internal::tFieldIndex<TField, TFields...>::cVALUE>(this->columns);
+  }
+
+  inline tRow operator[](size_t index)
+  {
+    return tRow(*this, index);
+  }
+
+  inline tConstRow operator[](size_t index) const
+  {
+    return tConstRow(*this, index);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tColumns columns;
+
+};
+
+template <typename ... TFields>
+const size_t tQuantityFrame<TFields...>::cNUMBER_OF_FIELDS;
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+/*!
+ * Writes one column as a self-describing batch (field name, tag, count and raw values)
+ */
+template <typename TField, typename ... TFields>
+inline void WriteColumn(serialization::tOutputStream &stream, const tQuantityFrame<TFields...> &frame)
+{
+  stream.WriteString(TField::Name());
+  const auto &column = frame.template Column<TField>();
+  WriteQuantities(stream, column.data(), column.size());
+}
+
+/*!
+ * Reads one column written by WriteColumn.
+ * Throws a std::runtime_error if the field name or the serialization tag does not match.
+ * Other columns are not resized.
+ */
+template <typename TField, typename ... TFields>
+inline void ReadColumn(serialization::tInputStream &stream, tQuantityFrame<TFields...> &frame)
+{
+  std::string name = stream.ReadString();
+  if (name != TField::Name())
+  {
+    throw std::runtime_error("Expected column '" + std::string(TField::Name()) + "' but found '" + name + "'");
+  }
+  ReadQuantities(stream, frame.template Column<TField>());
+}
+
+template <typename ... TFields>
+serialization::tOutputStream &operator << (serialization::tOutputStream &stream, const tQuantityFrame<TFields...> &frame)
+{
+  stream << static_cast<uint32_t>(sizeof...(TFields));
+  int expand[] = { (WriteColumn<TFields>(stream, frame), 0)... };
+  (void)expand;
+  return stream;
+}
+
+template <typename ... TFields>
+serialization::tInputStream &operator >> (serialization::tInputStream &stream, tQuantityFrame<TFields...> &frame)
+{
+  uint32_t number_of_fields;
+  stream >> number_of_fields;
+  if (number_of_fields != sizeof...(TFields))
+  {
+    throw std::runtime_error("Serialized frame has a different number of fields");
+  }
+  int expand[] = { (ReadColumn<TFields>(stream, frame), 0)... };
+  (void)expand;
+  size_t sizes[] = { frame.template Column<TFields>().size()... };
+  for (size_t size : sizes)
+  {
+    if (size != sizes[0])
+    {
+      throw std::runtime_error("Serialized frame has columns of different length");
+    }
+  }
+  return stream;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
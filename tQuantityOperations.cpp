@@ -0,0 +1,163 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tQuantityOperations.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdio>
+#include <limits>
+#include <map>
+#include <mutex>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define RRLIB_SI_UNITS_USE_TO_CHARS
+#endif
+#endif
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+struct tOperationsRegistry
+{
+  std::mutex mutex;
+  std::map<std::string, const tQuantityOperations *> operations;
+};
+
+// function-local so that registration from other static initializers is safe
+tOperationsRegistry &OperationsRegistry()
+{
+  static tOperationsRegistry registry;
+  return registry;
+}
+
+template <typename T>
+char *FormatFloatingPoint(char *output, T value)
+{
+#ifdef RRLIB_SI_UNITS_USE_TO_CHARS
+  return std::to_chars(output, output + internal::cMAX_NUMBER_LENGTH, value).ptr;
+#else
+  return output + std::snprintf(output, internal::cMAX_NUMBER_LENGTH, "%.*g", std::numeric_limits<T>::max_digits10, static_cast<double>(value));
+#endif
+}
+
+}
+
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// FormatNumber
+//----------------------------------------------------------------------
+char *FormatNumber(char *output, double value)
+{
+  return FormatFloatingPoint(output, value);
+}
+
+char *FormatNumber(char *output, float value)
+{
+  return FormatFloatingPoint(output, value);
+}
+
+char *FormatNumber(char *output, long long value)
+{
+  return output + std::snprintf(output, cMAX_NUMBER_LENGTH, "%lld", value);
+}
+
+char *FormatNumber(char *output, unsigned long long value)
+{
+  return output + std::snprintf(output, cMAX_NUMBER_LENGTH, "%llu", value);
+}
+
+}
+
+//----------------------------------------------------------------------
+// RegisterQuantityOperations
+//----------------------------------------------------------------------
+void RegisterQuantityOperations(const rtti::tType &type, const tQuantityOperations &operations)
+{
+  tOperationsRegistry &registry = OperationsRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.operations[type.GetName()] = &operations;
+}
+
+//----------------------------------------------------------------------
+// GetQuantityOperations
+//----------------------------------------------------------------------
+const tQuantityOperations *GetQuantityOperations(const rtti::tType &type)
+{
+  tOperationsRegistry &registry = OperationsRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto it = registry.operations.find(type.GetName());
+  return it != registry.operations.end() ? it->second : nullptr;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,301 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tQuantityOperations.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tQuantityOperations
+ *
+ * \b tQuantityOperations
+ *
+ * Type-erased batch operations for quantity types, reachable from their
+ * rrlib_rtti type. Generic tools (plotters, recorders, editors) that only
+ * know an rtti::tType and raw memory use this table instead of switching
+ * over all registered instantiations. Every operation works on a whole
+ * buffer, so there is one indirect call per buffer rather than per element.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tQuantityOperations_h__
+#define __rrlib__si_units__tQuantityOperations_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include "rrlib/math/tAngle.h"
+#include "rrlib/rtti/rtti.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tQuantity.h"
+#include "rrlib/si_units/tDimension.h"
+#include "rrlib/si_units/column_parser.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*! Access to the plain number inside a quantity value (angles are unwrapped) */
+template <typename TValue>
+struct tScalarValue
+{
+  typedef TValue tType;
+  static inline tType Get(TValue value)
+  {
+    return value;
+  }
+};
+
+template <typename T, typename TUnit, typename TPolicy>
+struct tScalarValue<math::tAngle<T, TUnit, TPolicy>>
+{
+  typedef T tType;
+  static inline tType Get(math::tAngle<T, TUnit, TPolicy> value)
+  {
+    return value.Value();
+  }
+};
+
+/*! Upper bound of characters written by FormatNumber */
+const size_t cMAX_NUMBER_LENGTH = 32;
+
+/*!
+ * Writes value so that it parses back exactly. With std::to_chars (C++17)
+ * the output is also the shortest such representation. The fallback printf
+ * with max_digits10 digits is exact, but not always shortest (0.1 is
+ * written as 0.10000000000000001). Integers are written with all digits.
+ *
+ * \param output Buffer with room for at least cMAX_NUMBER_LENGTH characters
+ * \return Position behind the last written character
+ */
+char *FormatNumber(char *output, double value);
+char *FormatNumber(char *output, float value);
+char *FormatNumber(char *output, long long value);
+char *FormatNumber(char *output, unsigned long long value);
+
+/*! Writes the plain number inside a quantity value with the matching FormatNumber overload */
+template <typename TValue>
+inline char *FormatValue(char *output, TValue value)
+{
+  typedef typename tScalarValue<TValue>::tType tScalar;
+  typedef typename std::conditional<std::is_signed<tScalar>::value, long long, unsigned long long>::type tInteger;
+  typedef typename std::conditional<std::is_same<tScalar, float>::value, float, double>::type tFloatingPoint;
+  typedef typename std::conditional<std::is_integral<tScalar>::value, tInteger, tFloatingPoint>::type tFormat;
+  return FormatNumber(output, static_cast<tFormat>(tScalarValue<TValue>::Get(value)));
+}
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Table of batch operations on buffers of one quantity type
+/*!
+ * Tables are created once per type by Get<TQuantity>() and live for the
+ * whole program. Buffers are passed as raw memory holding count values of
+ * the described type.
+ */
+struct tQuantityOperations
+{
+  /*! Dimension of the quantity type */
+  tDimension dimension;
+
+  /*! Size of one value in bytes */
+  size_t value_size;
+
+  /*!
+   * Converts count values (in base units) to double
+   */
+  void (*to_double)(const void *values, double *output, size_t count);
+
+  /*!
+   * Appends count values to output as "<value> <symbol>" separated by delimiter.
+   * Numbers are written with enough digits to be parsed back exactly.
+   */
+  void (*format)(const void *values, size_t count, std::string &output, char delimiter);
+
+  /*!
+   * Parses up to count values separated by delimiter or line breaks.
+   * Each value may carry any symbol of a compatible unit (e.g. "12.5 mm").
+   *
+   * \return Number of values parsed - parsing stops at the first invalid field or at the end of text
+   */
+  size_t (*parse)(const char *text, size_t size, void *values, size_t count, char delimiter);
+
+  template <typename TQuantity>
+  static const tQuantityOperations &Get();
+};
+
+namespace internal
+{
+
+template <typename TQuantity>
+struct tQuantityOperationsImplementation;
+
+template <typename TUnit, typename TValue>
+struct tQuantityOperationsImplementation<tQuantity<TUnit, TValue>>
+{
+  typedef tQuantity<TUnit, TValue> tQuantityType;
+  typedef typename tScalarValue<TValue>::tType tScalar;
+
+  static void ToDouble(const void *values, double *output, size_t count)
+  {
+    const tQuantityType *quantities = static_cast<const tQuantityType *>(values);
+    for (size_t i = 0; i < count; ++i)
+    {
+      output[i] = static_cast<double>(tScalarValue<TValue>::Get(quantities[i].Value()));
+    }
+  }
+
+  static void Format(const void *values, size_t count, std::string &output, char delimiter)
+  {
+    std::stringstream symbol_stream;
+    symbol_stream << TUnit();
+    const std::string symbol = symbol_stream.str();
+
+    const tQuantityType *quantities = static_cast<const tQuantityType *>(values);
+    char buffer[cMAX_NUMBER_LENGTH];
+    const size_t digits = std::max<size_t>(std::numeric_limits<tScalar>::max_digits10, std::numeric_limits<tScalar>::digits10 + 1);
+    output.reserve(output.size() + count * (symbol.length() + 2 + digits + 6));
+    for (size_t i = 0; i < count; ++i)
+    {
+      if (i)
+      {
+        output += delimiter;
+      }
+      output.append(buffer, FormatValue(buffer, quantities[i].Value()));
+      if (!symbol.empty())
+      {
+        output += ' ';
+        output += symbol;
+      }
+    }
+  }
+
+  static size_t Parse(const char *text, size_t size, void *values, size_t count, char delimiter)
+  {
+    tQuantityType *quantities = static_cast<tQuantityType *>(values);
+    tSymbolFactorCache symbol_factors(&GetCachedFactorToBaseUnit<TUnit>);
+    const char *end = text + size;
+    const char *field_begin = text;
+    size_t parsed = 0;
+    while (parsed < count && field_begin < end)
+    {
+      const char *field_end = field_begin;
+      while (field_end < end && *field_end != delimiter && *field_end != '\n')
+      {
+        ++field_end;
+      }
+
+      double value = 0;
+      double factor = 1;
+      const char *symbol_begin = nullptr;
+      const char *symbol_end = nullptr;
+      if (ParseQuantityField(field_begin, field_end, 0, delimiter, value, symbol_begin, symbol_end) ||
+          (symbol_begin != symbol_end && symbol_factors.Resolve(symbol_begin, symbol_end, factor)))
+      {
+        break;
+      }
+      quantities[parsed++] = tQuantityType(TValue(static_cast<tScalar>(factor * value)));
+      field_begin = field_end + 1;
+    }
+    return parsed;
+  }
+};
+
+}
+
+template <typename TQuantity>
+const tQuantityOperations &tQuantityOperations::Get()
+{
+  typedef internal::tQuantityOperationsImplementation<TQuantity> tImplementation;
+  static const tQuantityOperations operations =
+  {
+    tDimension(typename TQuantity::tUnit()),
+    sizeof(TQuantity),
+    &tImplementation::ToDouble,
+    &tImplementation::Format,
+    &tImplementation::Parse
+  };
+  return operations;
+}
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Makes the operations of a type available through its rtti type.
+ * Registration is thread-safe but usually happens during static initialization.
+ */
+void RegisterQuantityOperations(const rtti::tType &type, const tQuantityOperations &operations);
+
+/*!
+ * \return The operations table registered for type or nullptr if type is not a registered quantity type
+ */
+const tQuantityOperations *GetQuantityOperations(const rtti::tType &type);
+
+/*!
+ * Registers TQuantity with rrlib_rtti and its operations table
+ *
+ * \return The rtti type of TQuantity
+ */
+template <typename TQuantity>
+rtti::tType RegisterQuantityType()
+{
+  rtti::tType type = rtti::tDataType<TQuantity>();
+  RegisterQuantityOperations(type, tQuantityOperations::Get<TQuantity>());
+  return type;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
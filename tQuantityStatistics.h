@@ -0,0 +1,257 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tQuantityStatistics.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tQuantityStatistics
+ *
+ * \b tQuantityStatistics
+ *
+ * Online mean, variance, minimum and maximum of a stream of quantities
+ * (Welford's algorithm) with unit-typed results.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tQuantityStatistics_h__
+#define __rrlib__si_units__tQuantityStatistics_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tQuantity.h"
+#include "rrlib/si_units/reductions.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Streaming statistics of one quantity channel
+/*!
+ * Keeps count, mean, sum of squared deviations, minimum and maximum.
+ * Updates never allocate, lock or throw. One accumulator belongs to one
+ * writer thread; accumulators of several threads are combined with Merge().
+ */
+template <typename TUnit, typename TValue = double>
+class tQuantityStatistics
+{
+  static_assert(std::is_floating_point<TValue>::value, "Statistics are only supported for floating point value types");
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tQuantity<TUnit, TValue> tValue;
+  typedef tQuantity<typename operators::tProduct<TUnit, TUnit>::tResult, TValue> tVariance;
+
+  tQuantityStatistics()
+  {
+    this->Reset();
+  }
+
+  inline void Reset()
+  {
+    this->count = 0;
+    this->mean = 0;
+    this->sum_of_squared_deviations = 0;
+    this->minimum = std::numeric_limits<TValue>::infinity();
+    this->maximum = -std::numeric_limits<TValue>::infinity();
+  }
+
+  inline void Update(tValue quantity)
+  {
+    const TValue value = quantity.Value();
+    this->count++;
+    const TValue delta = value - this->mean;
+    this->mean += delta / static_cast<TValue>(this->count);
+    this->sum_of_squared_deviations += delta * (value - this->mean);
+    this->minimum = value < this->minimum ? value : this->minimum;
+    this->maximum = value > this->maximum ? value : this->maximum;
+  }
+
+  /*!
+   * Adds count quantities at once.
+   * The batch is reduced in two vectorized passes and then merged, which is
+   * faster and numerically at least as good as count single updates.
+   */
+  void Update(const tValue *quantities, size_t count)
+  {
+    if (count == 0)
+    {
+      return;
+    }
+    const TValue *values = internal::RawValues(quantities);
+    const TValue batch_mean = internal::SumKernel<TValue>(values, count) / static_cast<TValue>(count);
+    TValue accumulators[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      for (size_t k = 0; k < 8; ++k)
+      {
+        const TValue deviation = values[i + k] - batch_mean;
+        accumulators[k] += deviation * deviation;
+      }
+    }
+    for (; i < count; ++i)
+    {
+      const TValue deviation = values[i] - batch_mean;
+      accumulators[i & 7] += deviation * deviation;
+    }
+
+    tQuantityStatistics batch;
+    batch.count = count;
+    batch.mean = batch_mean;
+    batch.sum_of_squared_deviations = ((accumulators[0] + accumulators[4]) + (accumulators[1] + accumulators[5])) + ((accumulators[2] + accumulators[6]) + (accumulators[3] + accumulators[7]));
+    batch.minimum = internal::ExtremumKernel(values, count, [](TValue a, TValue b)
+    {
+      return a < b;
+    });
+    batch.maximum = internal::ExtremumKernel(values, count, [](TValue a, TValue b)
+    {
+      return a > b;
+    });
+    this->Merge(batch);
+  }
+
+  /*!
+   * Combines the statistics of other into this (Chan et al.)
+   */
+  void Merge(const tQuantityStatistics &other)
+  {
+    if (other.count == 0)
+    {
+      return;
+    }
+    if (this->count == 0)
+    {
+      *this = other;
+      return;
+    }
+    const uint64_t total = this->count + other.count;
+    const TValue delta = other.mean - this->mean;
+    const TValue other_weight = static_cast<TValue>(other.count) / static_cast<TValue>(total);
+    this->mean += delta * other_weight;
+    this->sum_of_squared_deviations += other.sum_of_squared_deviations + delta * delta * static_cast<TValue>(this->count) * other_weight;
+    this->count = total;
+    this->minimum = other.minimum < this->minimum ? other.minimum : this->minimum;
+    this->maximum = other.maximum > this->maximum ? other.maximum : this->maximum;
+  }
+
+  inline uint64_t Count() const
+  {
+    return this->count;
+  }
+
+  inline tValue Mean() const
+  {
+    return tValue(this->mean);
+  }
+
+  /*!
+   * Population variance (zero for fewer than two values)
+   */
+  inline tVariance Variance() const
+  {
+    return tVariance(this->count > 1 ? this->sum_of_squared_deviations / static_cast<TValue>(this->count) : 0);
+  }
+
+  /*!
+   * Unbiased sample variance (zero for fewer than two values)
+   */
+  inline tVariance SampleVariance() const
+  {
+    return tVariance(this->count > 1 ? this->sum_of_squared_deviations / static_cast<TValue>(this->count - 1) : 0);
+  }
+
+  inline tValue StandardDeviation() const
+  {
+    return tValue(std::sqrt(this->Variance().Value()));
+  }
+
+  inline tValue SampleStandardDeviation() const
+  {
+    return tValue(std::sqrt(this->SampleVariance().Value()));
+  }
+
+  /*!
+   * \return The smallest value (+infinity if no values were added)
+   */
+  inline tValue Minimum() const
+  {
+    return tValue(this->minimum);
+  }
+
+  /*!
+   * \return The largest value (-infinity if no values were added)
+   */
+  inline tValue Maximum() const
+  {
+    return tValue(this->maximum);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  uint64_t count;
+  TValue mean;
+  TValue sum_of_squared_deviations;
+  TValue minimum;
+  TValue maximum;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
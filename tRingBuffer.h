@@ -0,0 +1,290 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tRingBuffer.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tRingBuffer
+ *
+ * \b tRingBuffer
+ *
+ * Wait-free single-producer/single-consumer ring buffer for handing
+ * quantities (or quantity frame records) from driver to control threads.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tRingBuffer_h__
+#define __rrlib__si_units__tRingBuffer_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Alignment that keeps producer and consumer state on separate cache lines */
+const size_t cCACHE_LINE_SIZE = 64;
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Single-producer/single-consumer ring buffer
+/*!
+ * Exactly one thread may call the producer methods (Push, WritableSpan,
+ * Commit) and exactly one other thread the consumer methods (Pop,
+ * ReadableSpan, Release). Every operation finishes in a bounded number of
+ * steps without locks or allocation; a full or empty buffer is reported
+ * through the return value instead of blocking.
+ *
+ * Indices run freely and are masked with Tcapacity - 1, so all slots are
+ * usable. Each side caches the other side's index and only reloads it when
+ * the cached value suggests the buffer is full or empty.
+ *
+ * Before C++17, dynamically allocated instances are not guaranteed to be
+ * cache-line aligned - prefer members or static storage there.
+ */
+template <typename T, size_t Tcapacity>
+class tRingBuffer
+{
+  static_assert(Tcapacity >= 2 && (Tcapacity & (Tcapacity - 1)) == 0, "The capacity of a ring buffer must be a power of two");
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  //! Contiguous slots for zero-copy writing
+  struct tSpan
+  {
+    T *data;
+    size_t size;
+  };
+
+  //! Contiguous elements for zero-copy reading
+  struct tConstSpan
+  {
+    const T *data;
+    size_t size;
+  };
+
+  static const size_t cCAPACITY = Tcapacity;
+
+  tRingBuffer()
+    : write_index(0), cached_read_index(0), read_index(0), cached_write_index(0)
+  {}
+
+  tRingBuffer(const tRingBuffer &) = delete;
+  tRingBuffer &operator=(const tRingBuffer &) = delete;
+
+  // Producer side ------------------------------------------------------
+
+  /*!
+   * \return Whether value was added (false if the buffer is full)
+   */
+  inline bool Push(const T &value)
+  {
+    const size_t write = this->write_index.load(std::memory_order_relaxed);
+    if (write - this->cached_read_index == Tcapacity)
+    {
+      this->cached_read_index = this->read_index.load(std::memory_order_acquire);
+      if (write - this->cached_read_index == Tcapacity)
+      {
+        return false;
+      }
+    }
+    this->buffer[write & cMASK] = value;
+    this->write_index.store(write + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+   * Adds as many of count values as fit
+   *
+   * \return Number of values added
+   */
+  size_t Push(const T *values, size_t count)
+  {
+    const size_t write = this->write_index.load(std::memory_order_relaxed);
+    if (Tcapacity - (write - this->cached_read_index) < count)
+    {
+      this->cached_read_index = this->read_index.load(std::memory_order_acquire);
+    }
+    count = std::min(count, Tcapacity - (write - this->cached_read_index));
+    const size_t offset = write & cMASK;
+    const size_t first = std::min(count, Tcapacity - offset);
+    std::copy(values, values + first, this->buffer + offset);
+    std::copy(values + first, values + count, this->buffer);
+    this->write_index.store(write + count, std::memory_order_release);
+    return count;
+  }
+
+  /*!
+   * Free slots up to the end of the storage. Fill them and publish with Commit().
+   * The span may be shorter than the free space if the free space wraps around.
+   */
+  tSpan WritableSpan()
+  {
+    const size_t write = this->write_index.load(std::memory_order_relaxed);
+    const size_t offset = write & cMASK;
+    if (Tcapacity - (write - this->cached_read_index) < Tcapacity - offset)
+    {
+      this->cached_read_index = this->read_index.load(std::memory_order_acquire);
+    }
+    return tSpan { this->buffer + offset, std::min(Tcapacity - (write - this->cached_read_index), Tcapacity - offset) };
+  }
+
+  /*!
+   * Publishes count slots obtained from WritableSpan() to the consumer
+   */
+  inline void Commit(size_t count)
+  {
+    this->write_index.store(this->write_index.load(std::memory_order_relaxed) + count, std::memory_order_release);
+  }
+
+  // Consumer side ------------------------------------------------------
+
+  /*!
+   * \return Whether a value was removed (false if the buffer is empty)
+   */
+  inline bool Pop(T &value)
+  {
+    const size_t read = this->read_index.load(std::memory_order_relaxed);
+    if (read == this->cached_write_index)
+    {
+      this->cached_write_index = this->write_index.load(std::memory_order_acquire);
+      if (read == this->cached_write_index)
+      {
+        return false;
+      }
+    }
+    value = this->buffer[read & cMASK];
+    this->read_index.store(read + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+   * Removes up to count values in order
+   *
+   * \return Number of values removed
+   */
+  size_t Pop(T *values, size_t count)
+  {
+    const size_t read = this->read_index.load(std::memory_order_relaxed);
+    if (this->cached_write_index - read < count)
+    {
+      this->cached_write_index = this->write_index.load(std::memory_order_acquire);
+    }
+    count = std::min(count, this->cached_write_index - read);
+    const size_t offset = read & cMASK;
+    const size_t first = std::min(count, Tcapacity - offset);
+    std::copy(this->buffer + offset, this->buffer + offset + first, values);
+    std::copy(this->buffer, this->buffer + (count - first), values + first);
+    this->read_index.store(read + count, std::memory_order_release);
+    return count;
+  }
+
+  /*!
+   * Available elements up to the end of the storage. They stay valid until Release().
+   */
+  tConstSpan ReadableSpan()
+  {
+    const size_t read = this->read_index.load(std::memory_order_relaxed);
+    const size_t offset = read & cMASK;
+    if (this->cached_write_index - read < Tcapacity - offset)
+    {
+      this->cached_write_index = this->write_index.load(std::memory_order_acquire);
+    }
+    return tConstSpan { this->buffer + offset, std::min(this->cached_write_index - read, Tcapacity - offset) };
+  }
+
+  /*!
+   * Hands count elements obtained from ReadableSpan() back to the producer
+   */
+  inline void Release(size_t count)
+  {
+    this->read_index.store(this->read_index.load(std::memory_order_relaxed) + count, std::memory_order_release);
+  }
+
+  // Either side --------------------------------------------------------
+
+  /*!
+   * \return Number of stored elements (a snapshot if the other side is active)
+   */
+  inline size_t Size() const
+  {
+    const size_t read = this->read_index.load(std::memory_order_acquire);
+    return this->write_index.load(std::memory_order_acquire) - read;
+  }
+
+  inline bool Empty() const
+  {
+    return this->Size() == 0;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  static const size_t cMASK = Tcapacity - 1;
+
+  alignas(cCACHE_LINE_SIZE) std::atomic<size_t> write_index;
+  size_t cached_read_index;   // producer only
+
+  alignas(cCACHE_LINE_SIZE) std::atomic<size_t> read_index;
+  size_t cached_write_index;  // consumer only
+
+  alignas(cCACHE_LINE_SIZE) T buffer[Tcapacity];
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
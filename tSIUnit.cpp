@@ -31,7 +31,10 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
-#include <set>
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -63,27 +66,37 @@ namespace si_units
 // Const values
 //----------------------------------------------------------------------
 
-const std::set<tSymbol> &BasicUnitSymbols()
+const std::vector<tSymbol> &BasicUnitSymbols()
 {
-  static const std::set<tSymbol> cBASIC_UNIT_SYMBOLS
+  // ordered by dimension index
+  static const std::vector<tSymbol> cBASIC_UNIT_SYMBOLS
   {
     tSymbol(tMeter(), "m"),
     tSymbol(tKilogram(), "kg"),
     tSymbol(tSecond(), "s"),
     tSymbol(tAmpere(), "A"),
     tSymbol(tKelvin(), "K"),
-    tSymbol(tCandela(), "cd"),
-    tSymbol(tMole(), "mol")
+    tSymbol(tMole(), "mol"),
+    tSymbol(tCandela(), "cd")
   };
   return cBASIC_UNIT_SYMBOLS;
 }
 
-const std::set<tSymbol> &DerivedUnitSymbols()
+const std::vector<tSymbol> &DerivedUnitSymbols()
 {
-  static const std::set<tSymbol> cDERIVED_UNIT_SYMBOLS
+  // J is missing on purpose: it shares its dimension with torque, which prints as Nm.
+  // Energies print as J via UseSymbol or tScopedSymbolContext only.
+  static const std::vector<tSymbol> cDERIVED_UNIT_SYMBOLS
   {
     tSymbol(tNewton(), "N"),
-    tSymbol(tPascal(), "Pa")
+    tSymbol(tPascal(), "Pa"),
+    tSymbol(tWatt(), "W"),
+    tSymbol(tCoulomb(), "C"),
+    tSymbol(tVolt(), "V"),
+    tSymbol(tFarad(), "F"),
+    tSymbol(tOhm(), "Ω"),
+    tSymbol(tWeber(), "Wb"),
+    tSymbol(tTesla(), "T")
   };
   return cDERIVED_UNIT_SYMBOLS;
 };
@@ -95,75 +108,331 @@ const std::set<tSymbol> &DerivedUnitSymbols()
 namespace
 {
 
+/*! A symbol with its multiplicity (negative for the denominator) */
+struct tTerm
+{
+  const tSymbol *symbol;
+  int multiplicity;
+};
+
+/*! Components of a rendered unit */
+struct tSymbolComponents
+{
+  std::vector<std::string> nominator;
+  std::vector<std::string> denominator;
+};
+
+/*!
+ * Cost of a decomposition, compared lexicographically:
+ * number of printed symbols, number of built-in derived symbols
+ * (so that e.g. m/s^2 is not rendered as N/kg) and sum of absolute multiplicities.
+ */
+struct tCost
+{
+  unsigned int symbols;
+  unsigned int built_in_derived_symbols;
+  unsigned int magnitude;
+
+  bool operator < (const tCost &other) const
+  {
+    if (this->symbols != other.symbols)
+    {
+      return this->symbols < other.symbols;
+    }
+    if (this->built_in_derived_symbols != other.built_in_derived_symbols)
+    {
+      return this->built_in_derived_symbols < other.built_in_derived_symbols;
+    }
+    return this->magnitude < other.magnitude;
+  }
+};
+
+/*! Candidate symbols in order of preference */
+struct tCandidate
+{
+  const tSymbol *symbol;
+  bool built_in;
+};
+
+const size_t cMAXIMUM_NUMBER_OF_TERMS = 2;
+const size_t cMAXIMUM_NUMBER_OF_CONTEXT_MEMOS = 16;
+
+/*! Memoized decompositions for one set of active scoped context symbols */
+struct tContextMemo
+{
+  std::vector<tSymbol> context_symbols;
+  std::unordered_map<uint64_t, tSymbolComponents> components;
+};
+
+/*!
+ * Memoized decompositions for the symbols that do not depend on a stream.
+ * One cache per thread, so that printing needs no synchronization and
+ * the scoped symbol contexts of a thread only affect its own cache.
+ * Memos are keyed by the symbols of the active contexts, so entering and
+ * leaving contexts (e.g. once per loop iteration) reuses earlier results.
+ */
+struct tDecompositionCache
+{
+  uint64_t registry_generation = 0;
+  std::vector<tContextMemo> memos;
+  std::vector<tSymbol> active_context_symbols;
+};
+
+tDecompositionCache &DecompositionCache()
+{
+  thread_local tDecompositionCache cache;
+  return cache;
+}
+
 //----------------------------------------------------------------------
-// ExtractSymbolFromExponents
+// Subtract
 //----------------------------------------------------------------------
-bool ExtractSymbolFromExponents(tSymbol symbol, int *exponents)
+void Subtract(int *exponents, const tSymbol &symbol, int multiplicity)
 {
   for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
   {
-    if (symbol.cEXPONENTS[i] > 0 && exponents[i] < symbol.cEXPONENTS[i])
-    {
-      return false;
-    }
-    if (symbol.cEXPONENTS[i] < 0 && exponents[i] > symbol.cEXPONENTS[i])
+    exponents[i] -= multiplicity * symbol.Exponent(i);
+  }
+}
+
+//----------------------------------------------------------------------
+// CandidateMultiplicities
+//----------------------------------------------------------------------
+size_t CandidateMultiplicities(const int *exponents, const tSymbol &symbol, int *multiplicities)
+{
+  // each multiplicity eliminates at least one dimension of the remaining exponents
+  size_t count = 0;
+  for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
+  {
+    int symbol_exponent = symbol.Exponent(i);
+    if (symbol_exponent != 0 && exponents[i] != 0 && exponents[i] % symbol_exponent == 0)
     {
-      return false;
+      int multiplicity = exponents[i] / symbol_exponent;
+      if (std::find(multiplicities, multiplicities + count, multiplicity) == multiplicities + count)
+      {
+        multiplicities[count++] = multiplicity;
+      }
     }
   }
+  return count;
+}
 
+//----------------------------------------------------------------------
+// Evaluate
+//----------------------------------------------------------------------
+tCost Evaluate(const int *residual, const tTerm *terms, const bool *built_in, size_t number_of_terms)
+{
+  tCost cost = { 0, 0, 0 };
+  for (size_t i = 0; i < number_of_terms; ++i)
+  {
+    cost.symbols++;
+    cost.built_in_derived_symbols += built_in[i] ? 1 : 0;
+    cost.magnitude += std::abs(terms[i].multiplicity);
+  }
   for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
   {
-    exponents[i] -= symbol.cEXPONENTS[i];
+    cost.symbols += residual[i] != 0 ? 1 : 0;
+    cost.magnitude += std::abs(residual[i]);
   }
+  return cost;
+}
 
-  return true;
+//----------------------------------------------------------------------
+// AppendComponent
+//----------------------------------------------------------------------
+void AppendComponent(tSymbolComponents &components, const tTerm &term)
+{
+  std::vector<std::string> &output = term.multiplicity > 0 ? components.nominator : components.denominator;
+  output.push_back(term.symbol->String());
+  if (std::abs(term.multiplicity) > 1)
+  {
+    output.back() += "^" + std::to_string(std::abs(term.multiplicity));
+  }
 }
 
 //----------------------------------------------------------------------
-// ProcessSymbol
+// Decompose
 //----------------------------------------------------------------------
-void ProcessSymbol(std::vector<std::string> &output, int *exponents, const tSymbol &symbol)
+tSymbolComponents Decompose(const int *exponents, const std::vector<tCandidate> &candidates)
 {
-  unsigned int multiplicity = 0;
-  while (ExtractSymbolFromExponents(symbol, exponents))
+  // Find the representation with the fewest symbols using up to cMAXIMUM_NUMBER_OF_TERMS
+  // candidate symbols. The multiplicities of candidates follow in closed form from the
+  // exponents they eliminate, the remaining exponents are covered by the basic units.
+  // On equal cost, earlier candidates and candidates before pure basic units win.
+  tTerm best_terms[cMAXIMUM_NUMBER_OF_TERMS];
+  size_t best_number_of_terms = 0;
+  tCost best_cost = { std::numeric_limits<unsigned int>::max(), 0, 0 };
+
+  int residual[cNUMBER_OF_BASIC_DIMENSIONS];
+  int second_residual[cNUMBER_OF_BASIC_DIMENSIONS];
+  int multiplicities[cNUMBER_OF_BASIC_DIMENSIONS];
+  int second_multiplicities[cNUMBER_OF_BASIC_DIMENSIONS];
+  tTerm terms[cMAXIMUM_NUMBER_OF_TERMS];
+  bool built_in[cMAXIMUM_NUMBER_OF_TERMS];
+
+  auto consider = [&](const int *remaining, size_t number_of_terms)
   {
-    multiplicity++;
+    tCost cost = Evaluate(remaining, terms, built_in, number_of_terms);
+    if (cost < best_cost)
+    {
+      best_cost = cost;
+      best_number_of_terms = number_of_terms;
+      std::copy(terms, terms + number_of_terms, best_terms);
+    }
+  };
+
+  for (size_t i = 0; i < candidates.size(); ++i)
+  {
+    size_t number_of_multiplicities = CandidateMultiplicities(exponents, *candidates[i].symbol, multiplicities);
+    for (size_t k = 0; k < number_of_multiplicities; ++k)
+    {
+      std::copy(exponents, exponents + cNUMBER_OF_BASIC_DIMENSIONS, residual);
+      Subtract(residual, *candidates[i].symbol, multiplicities[k]);
+      terms[0] = tTerm { candidates[i].symbol, multiplicities[k] };
+      built_in[0] = candidates[i].built_in;
+      consider(residual, 1);
+
+      for (size_t j = i + 1; j < candidates.size(); ++j)
+      {
+        size_t number_of_second_multiplicities = CandidateMultiplicities(residual, *candidates[j].symbol, second_multiplicities);
+        for (size_t l = 0; l < number_of_second_multiplicities; ++l)
+        {
+          std::copy(residual, residual + cNUMBER_OF_BASIC_DIMENSIONS, second_residual);
+          Subtract(second_residual, *candidates[j].symbol, second_multiplicities[l]);
+          terms[1] = tTerm { candidates[j].symbol, second_multiplicities[l] };
+          built_in[1] = candidates[j].built_in;
+          consider(second_residual, 2);
+        }
+      }
+    }
   }
-  if (multiplicity > 0)
+  consider(exponents, 0);
+
+  // derived symbols are heavier than basic ones and are printed first
+  std::vector<tTerm> all_terms(best_terms, best_terms + best_number_of_terms);
+  std::stable_sort(all_terms.begin(), all_terms.end(), [](const tTerm & left, const tTerm & right)
+  {
+    return right.symbol->Order() < left.symbol->Order();
+  });
+  std::copy(exponents, exponents + cNUMBER_OF_BASIC_DIMENSIONS, residual);
+  for (auto & term : all_terms)
+  {
+    Subtract(residual, *term.symbol, term.multiplicity);
+  }
+  for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
   {
-    output.push_back(symbol.cSYMBOL);
-    if (multiplicity > 1)
+    if (residual[i] != 0)
     {
-      output.back() += "^" + std::to_string(multiplicity);
+      all_terms.push_back(tTerm { &BasicUnitSymbols()[i], residual[i] });
     }
   }
+
+  tSymbolComponents components;
+  for (auto & term : all_terms)
+  {
+    AppendComponent(components, term);
+  }
+  return components;
 }
 
 //----------------------------------------------------------------------
-// FlipExponents
+// AddCandidates
 //----------------------------------------------------------------------
-void FlipExponents(int *exponents)
+template <typename TIterator>
+void AddCandidates(std::vector<tCandidate> &candidates, TIterator begin, TIterator end, bool built_in)
 {
-  for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
+  for (TIterator it = begin; it != end; ++it)
   {
-    exponents[i] = -exponents[i];
+    candidates.push_back(tCandidate { &*it, built_in });
   }
 }
 
 //----------------------------------------------------------------------
-// ExponentsAreZero
+// AddSharedCandidates
 //----------------------------------------------------------------------
-bool ExponentsAreZero(int *exponents)
+void AddSharedCandidates(std::vector<tCandidate> &candidates, const tUserDefinedSymbolsRegistry &registry)
 {
-  for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
+  for (const tScopedSymbolContext *context = tScopedSymbolContext::Current(); context; context = context->Parent())
   {
-    if (exponents[i] != 0)
+    AddCandidates(candidates, context->Symbols().rbegin(), context->Symbols().rend(), false);
+  }
+  AddCandidates(candidates, registry.GlobalSymbols().rbegin(), registry.GlobalSymbols().rend(), false);
+  AddCandidates(candidates, DerivedUnitSymbols().begin(), DerivedUnitSymbols().end(), true);
+}
+
+//----------------------------------------------------------------------
+// CollectContextSymbols
+//----------------------------------------------------------------------
+void CollectContextSymbols(std::vector<tSymbol> &symbols)
+{
+  // same order as in AddSharedCandidates
+  symbols.clear();
+  for (const tScopedSymbolContext *context = tScopedSymbolContext::Current(); context; context = context->Parent())
+  {
+    symbols.insert(symbols.end(), context->Symbols().rbegin(), context->Symbols().rend());
+  }
+}
+
+//----------------------------------------------------------------------
+// ContextMemo
+//----------------------------------------------------------------------
+tContextMemo &ContextMemo(tDecompositionCache &cache)
+{
+  CollectContextSymbols(cache.active_context_symbols);
+  for (auto & memo : cache.memos)
+  {
+    if (memo.context_symbols == cache.active_context_symbols)
     {
-      return false;
+      return memo;
     }
   }
-  return true;
+  if (cache.memos.size() == cMAXIMUM_NUMBER_OF_CONTEXT_MEMOS)
+  {
+    cache.memos.erase(cache.memos.begin());
+  }
+  cache.memos.push_back(tContextMemo { cache.active_context_symbols, {} });
+  return cache.memos.back();
+}
+
+//----------------------------------------------------------------------
+// CachedSymbolComponents
+//----------------------------------------------------------------------
+const tSymbolComponents &CachedSymbolComponents(int *exponents)
+{
+  tUserDefinedSymbolsRegistry &registry = tUserDefinedSymbols::Instance();
+  tDecompositionCache &cache = DecompositionCache();
+  if (cache.registry_generation != registry.Generation())
+  {
+    cache.memos.clear();
+    cache.registry_generation = registry.Generation();
+  }
+  tContextMemo &memo = ContextMemo(cache);
+  uint64_t key = tDimension(exponents).Packed();
+  auto it = memo.components.find(key);
+  if (it == memo.components.end())
+  {
+    std::vector<tCandidate> candidates;
+    AddSharedCandidates(candidates, registry);
+    it = memo.components.emplace(key, Decompose(exponents, candidates)).first;
+  }
+  return it->second;
+}
+
+//----------------------------------------------------------------------
+// JoinSymbolComponents
+//----------------------------------------------------------------------
+std::ostream &JoinSymbolComponents(std::ostream &stream, const std::vector<std::string> &nominator, const std::vector<std::string> &denominator)
+{
+  if (!nominator.empty())
+  {
+    stream << util::Join(nominator, "");
+  }
+  if (!denominator.empty())
+  {
+    stream << (nominator.empty() ? "1/" : "/");
+    stream << util::Join(denominator, "");
+  }
+  return stream;
 }
 
 }
@@ -173,31 +442,53 @@ bool ExponentsAreZero(int *exponents)
 //----------------------------------------------------------------------
 void DetermineSymbolComponentsFromExponentList(std::vector<std::string> &nominator, std::vector<std::string> &denominator, int *exponents, std::ostream &stream)
 {
-  std::set<tSymbol> symbols;
-
   int registry_key = stream.iword(tUserDefinedSymbolsRegistry::KeyIOSIndex());
   if (registry_key != 0)
   {
-    symbols.insert(tUserDefinedSymbols::Instance().TemporaryStreamSymbols(registry_key).rbegin(), tUserDefinedSymbols::Instance().TemporaryStreamSymbols(registry_key).rend());
-    symbols.insert(tUserDefinedSymbols::Instance().PersistentStreamSymbols(registry_key).rbegin(), tUserDefinedSymbols::Instance().PersistentStreamSymbols(registry_key).rend());
-    tUserDefinedSymbols::Instance().ClearTemporaryStreamSymbols(registry_key);
-  }
-  symbols.insert(tUserDefinedSymbols::Instance().GlobalSymbols().rbegin(), tUserDefinedSymbols::Instance().GlobalSymbols().rend());
-  symbols.insert(DerivedUnitSymbols().begin(), DerivedUnitSymbols().end());
-  symbols.insert(BasicUnitSymbols().begin(), BasicUnitSymbols().end());
-
-  for (auto it = symbols.rbegin(); it != symbols.rend(); ++it)
-  {
-    ProcessSymbol(nominator, exponents, *it);
-    FlipExponents(exponents);
-    ProcessSymbol(denominator, exponents, *it);
-    FlipExponents(exponents);
-    if (ExponentsAreZero(exponents))
+    tUserDefinedSymbolsRegistry &registry = tUserDefinedSymbols::Instance();
+    if (!(registry.TemporaryStreamSymbols(registry_key).empty() && registry.PersistentStreamSymbols(registry_key).empty()))
     {
-      break;
+      // user-defined symbols registered last have the highest priority
+      std::vector<tCandidate> candidates;
+      AddCandidates(candidates, registry.TemporaryStreamSymbols(registry_key).rbegin(), registry.TemporaryStreamSymbols(registry_key).rend(), false);
+      AddCandidates(candidates, registry.PersistentStreamSymbols(registry_key).rbegin(), registry.PersistentStreamSymbols(registry_key).rend(), false);
+      AddSharedCandidates(candidates, registry);
+
+      tSymbolComponents components = Decompose(exponents, candidates);
+      registry.ClearTemporaryStreamSymbols(registry_key);
+      nominator = std::move(components.nominator);
+      denominator = std::move(components.denominator);
+      return;
     }
   }
-  assert(ExponentsAreZero(exponents));
+
+  const tSymbolComponents &components = CachedSymbolComponents(exponents);
+  nominator = components.nominator;
+  denominator = components.denominator;
+}
+
+//----------------------------------------------------------------------
+// WriteSymbolFromExponentList
+//----------------------------------------------------------------------
+std::ostream &WriteSymbolFromExponentList(std::ostream &stream, int *exponents)
+{
+  std::vector<std::string> nominator;
+  std::vector<std::string> denominator;
+
+  DetermineSymbolComponentsFromExponentList(nominator, denominator, exponents, stream);
+
+  return JoinSymbolComponents(stream, nominator, denominator);
+}
+
+//----------------------------------------------------------------------
+// SymbolFromExponentList
+//----------------------------------------------------------------------
+std::string SymbolFromExponentList(int *exponents)
+{
+  const tSymbolComponents &components = CachedSymbolComponents(exponents);
+  std::ostringstream stream;
+  JoinSymbolComponents(stream, components.nominator, components.denominator);
+  return stream.str();
 }
 
 
@@ -86,27 +86,19 @@ struct tSIUnit
 
 void DetermineSymbolComponentsFromExponentList(std::vector<std::string> &nominator, std::vector<std::string> &denominator, int *exponents, std::ostream &stream);
 
+std::ostream &WriteSymbolFromExponentList(std::ostream &stream, int *exponents);
+
+/*!
+ * Symbol of a unit without a stream (global symbols and the scoped symbol contexts of the current thread apply)
+ */
+std::string SymbolFromExponentList(int *exponents);
+
 
 template <int Tlength, int Tmass, int Ttime, int Telectric_current, int Ttemperature, int Tamount_of_substance, int Tluminous_intensity>
 std::ostream &operator << (std::ostream &stream, tSIUnit<Tlength, Tmass, Ttime, Telectric_current, Ttemperature, Tamount_of_substance, Tluminous_intensity> unit)
 {
-  std::vector<std::string> nominator;
-  std::vector<std::string> denominator;
   int exponents[cNUMBER_OF_BASIC_DIMENSIONS] = { Tlength, Tmass, Ttime, Telectric_current, Ttemperature, Tamount_of_substance, Tluminous_intensity };
-
-  DetermineSymbolComponentsFromExponentList(nominator, denominator, exponents, stream);
-
-  if (!nominator.empty())
-  {
-    stream << util::Join(nominator, "");
-  }
-  if (!denominator.empty())
-  {
-    stream << (nominator.empty() ? "1/" : "/");
-    stream << util::Join(denominator, "");
-  }
-
-  return stream;
+  return WriteSymbolFromExponentList(stream, exponents);
 }
 
 //----------------------------------------------------------------------
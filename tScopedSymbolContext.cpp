@@ -0,0 +1,112 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tScopedSymbolContext.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+thread_local tScopedSymbolContext *current_context = nullptr;
+}
+
+//----------------------------------------------------------------------
+// tScopedSymbolContext constructors
+//----------------------------------------------------------------------
+tScopedSymbolContext::tScopedSymbolContext() :
+  parent(current_context)
+{
+  current_context = this;
+}
+
+//----------------------------------------------------------------------
+// tScopedSymbolContext destructor
+//----------------------------------------------------------------------
+tScopedSymbolContext::~tScopedSymbolContext()
+{
+  assert(current_context == this && "Scoped symbol contexts must be destroyed in reverse order on the thread that created them");
+  current_context = this->parent;
+}
+
+//----------------------------------------------------------------------
+// tScopedSymbolContext Add
+//----------------------------------------------------------------------
+void tScopedSymbolContext::Add(const tSymbol &symbol)
+{
+  this->symbols.push_back(symbol);
+}
+
+//----------------------------------------------------------------------
+// tScopedSymbolContext Current
+//----------------------------------------------------------------------
+const tScopedSymbolContext *tScopedSymbolContext::Current()
+{
+  return current_context;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
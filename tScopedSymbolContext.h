@@ -0,0 +1,150 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tScopedSymbolContext.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tScopedSymbolContext
+ *
+ * \b tScopedSymbolContext
+ *
+ * Installs additional symbols for the current thread while it is in scope,
+ * e.g. to print all energies of a worker thread as Ws:
+ *
+ *   tScopedSymbolContext context(tJoule(), "Ws");
+ *
+ * Symbols are labels only: values are not scaled, so a symbol must denote
+ * the unit itself (factor 1), not e.g. Wh for J.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tScopedSymbolContext_h__
+#define __rrlib__si_units__tScopedSymbolContext_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tSymbol.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Thread-local symbols with RAII lifetime
+/*!
+ * Contexts nest: symbols of inner contexts and symbols added last take precedence.
+ * They are used for printing in the current thread after stream-specific
+ * symbols (UseSymbol) and before globally registered symbols. Reading them
+ * only involves a thread-local pointer, so worker threads with own contexts
+ * do not contend on shared state.
+ *
+ * Contexts must be destroyed in reverse order of construction on the thread that created them.
+ */
+class tScopedSymbolContext
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tScopedSymbolContext();
+
+  template <typename TUnit>
+  tScopedSymbolContext(const TUnit &unit, const std::string &symbol)
+    : tScopedSymbolContext()
+  {
+    this->Add(tSymbol(unit, symbol));
+  }
+
+  ~tScopedSymbolContext();
+
+  tScopedSymbolContext(const tScopedSymbolContext &) = delete;
+  tScopedSymbolContext &operator = (const tScopedSymbolContext &) = delete;
+
+  void Add(const tSymbol &symbol);
+
+  template <typename TUnit>
+  inline void Add(const TUnit &unit, const std::string &symbol)
+  {
+    this->Add(tSymbol(unit, symbol));
+  }
+
+  inline const std::vector<tSymbol> &Symbols() const
+  {
+    return this->symbols;
+  }
+
+  /*!
+   * \return The enclosing context of the same thread or nullptr
+   */
+  inline const tScopedSymbolContext *Parent() const
+  {
+    return this->parent;
+  }
+
+  /*!
+   * \return The innermost context of the current thread or nullptr
+   */
+  static const tScopedSymbolContext *Current();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tScopedSymbolContext *parent;
+  std::vector<tSymbol> symbols;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,263 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tSerializationTag.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tSerializationTag
+ *
+ * \b tSerializationTag
+ *
+ * A compact tag describing the unit and value type of serialized quantities.
+ * Writing it once per stream or per batch makes binary recordings
+ * self-describing while the values themselves stay raw.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tSerializationTag_h__
+#define __rrlib__si_units__tSerializationTag_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "rrlib/math/tAngle.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tDimension.h"
+#include "rrlib/si_units/tQuantity.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+enum tValueTypeId : uint8_t
+{
+  eVTI_UNKNOWN,
+  eVTI_INT8,
+  eVTI_UINT8,
+  eVTI_INT16,
+  eVTI_UINT16,
+  eVTI_INT32,
+  eVTI_UINT32,
+  eVTI_INT64,
+  eVTI_UINT64,
+  eVTI_FLOAT,
+  eVTI_DOUBLE,
+
+  eVTI_ANGLE_RADIAN = 0x40, //!< flag for math::tAngle in radian (combined with the id of the underlying type)
+  eVTI_ANGLE_DEGREE = 0x80  //!< flag for math::tAngle in degree (combined with the id of the underlying type)
+};
+
+/*!
+ * Maps value types to their tValueTypeId
+ */
+template <typename TValue>
+struct ValueTypeId
+{
+  static const uint8_t cVALUE =
+    std::is_floating_point<TValue>::value ? (sizeof(TValue) == 4 ? eVTI_FLOAT : sizeof(TValue) == 8 ? eVTI_DOUBLE : eVTI_UNKNOWN) :
+    std::is_integral<TValue>::value ? (sizeof(TValue) == 1 ? eVTI_INT8 : sizeof(TValue) == 2 ? eVTI_INT16 : sizeof(TValue) == 4 ? eVTI_INT32 : sizeof(TValue) == 8 ? eVTI_INT64 : eVTI_UNKNOWN) + (std::is_unsigned<TValue>::value ? 1 : 0) :
+    eVTI_UNKNOWN;
+};
+
+template <typename TValue, typename TAngleUnit, typename TPolicy>
+struct ValueTypeId<math::tAngle<TValue, TAngleUnit, TPolicy>>
+{
+  static const uint8_t cVALUE = ValueTypeId<TValue>::cVALUE | (std::is_same<TAngleUnit, math::angle::Degree>::value ? eVTI_ANGLE_DEGREE : eVTI_ANGLE_RADIAN);
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Unit and value type description of serialized quantities
+/*!
+ * Consists of the packed dimension (8 bytes) and the value type id (1 byte)
+ */
+class tSerializationTag
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tSerializationTag()
+    : value_type(eVTI_UNKNOWN)
+  {}
+
+  tSerializationTag(tDimension dimension, uint8_t value_type)
+    : dimension(dimension),
+      value_type(value_type)
+  {}
+
+  inline tDimension Dimension() const
+  {
+    return this->dimension;
+  }
+
+  inline uint8_t ValueType() const
+  {
+    return this->value_type;
+  }
+
+  /*!
+   * Throws a std::runtime_error if this tag does not match the expected one
+   *
+   * \param expected The tag of the type that is going to be read
+   */
+  inline void Check(tSerializationTag expected) const
+  {
+    if (this->dimension != expected.dimension || this->value_type != expected.value_type)
+    {
+      std::ostringstream message;
+      message << "Serialized quantities of unit '" << this->dimension << "' (value type " << static_cast<int>(this->value_type) << ") cannot be read as unit '" << expected.dimension << "' (value type " << static_cast<int>(expected.value_type) << ")";
+      throw std::runtime_error(message.str());
+    }
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tDimension dimension;
+  uint8_t value_type;
+
+};
+
+template <typename TQuantity>
+inline tSerializationTag GetSerializationTag()
+{
+  return tSerializationTag(tDimension(typename TQuantity::tUnit()), ValueTypeId<typename TQuantity::tValue>::cVALUE);
+}
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+inline serialization::tOutputStream& operator << (serialization::tOutputStream &stream, tSerializationTag tag)
+{
+  stream << tag.Dimension().Packed() << tag.ValueType();
+  return stream;
+}
+
+inline serialization::tInputStream& operator >> (serialization::tInputStream &stream, tSerializationTag &tag)
+{
+  uint64_t packed;
+  uint8_t value_type;
+  stream >> packed >> value_type;
+  tag = tSerializationTag(tDimension(packed), value_type);
+  return stream;
+}
+
+/*!
+ * Reads a tag from the stream and checks it against TQuantity.
+ * Use this once per stream if the writer put GetSerializationTag<TQuantity>() in front of the values.
+ *
+ * \param stream Stream to read from
+ */
+template <typename TQuantity>
+inline void ReadAndCheckSerializationTag(serialization::tInputStream &stream)
+{
+  tSerializationTag tag;
+  stream >> tag;
+  tag.Check(GetSerializationTag<TQuantity>());
+}
+
+/*!
+ * Writes a self-describing batch of quantities: tag, number of values and the raw values.
+ * The values are copied in host byte order, so batches can only be read on
+ * machines with the same endianness and floating point format.
+ *
+ * \param stream Stream to write to
+ * \param quantities Pointer to the first quantity
+ * \param count Number of quantities
+ */
+template <typename TUnit, typename TValue>
+inline void WriteQuantities(serialization::tOutputStream &stream, const tQuantity<TUnit, TValue> *quantities, size_t count)
+{
+  stream << GetSerializationTag<tQuantity<TUnit, TValue>>() << static_cast<uint64_t>(count);
+  stream.Write(quantities, count * sizeof(tQuantity<TUnit, TValue>));
+}
+
+/*!
+ * Reads a batch written by WriteQuantities (in host byte order).
+ * The tag is checked once and a std::runtime_error is thrown if it does not match.
+ *
+ * The number of values in the stream is not trusted: the vector grows in chunks
+ * as values are actually read, so a corrupted count fails at the end of the
+ * stream instead of allocating memory for it.
+ *
+ * \param stream Stream to read from
+ * \param quantities Vector that is filled with the read quantities
+ */
+template <typename TUnit, typename TValue>
+inline void ReadQuantities(serialization::tInputStream &stream, std::vector<tQuantity<TUnit, TValue>> &quantities)
+{
+  const size_t cCHUNK_SIZE = (1 << 16) / sizeof(tQuantity<TUnit, TValue>) + 1;
+  ReadAndCheckSerializationTag<tQuantity<TUnit, TValue>>(stream);
+  uint64_t count;
+  stream >> count;
+  if (count > quantities.max_size())
+  {
+    throw std::runtime_error("Invalid number of serialized quantities: " + std::to_string(count));
+  }
+  quantities.clear();
+  for (size_t read = 0; read < count;)
+  {
+    const size_t chunk = std::min<size_t>(count - read, cCHUNK_SIZE);
+    quantities.resize(read + chunk);
+    stream.ReadFully(quantities.data() + read, chunk * sizeof(tQuantity<TUnit, TValue>));
+    read += chunk;
+  }
+}
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
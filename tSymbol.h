@@ -43,10 +43,15 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/si_units/tDimension.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -59,6 +64,14 @@ namespace si_units
 //----------------------------------------------------------------------
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
+namespace internal
+{
+/*!
+ * Returns the unique, never released copy of symbol from a global string table.
+ * Equal strings yield the same pointer.
+ */
+const std::string *InternSymbolString(const std::string &symbol);
+}
 
 //----------------------------------------------------------------------
 // Class declaration
@@ -66,6 +79,9 @@ namespace si_units
 //! SHORT_DESCRIPTION
 /*!
  * This class implements the mapping between a (derived) SI unit and its symbol
+ *
+ * Symbol strings are interned, so tSymbol is trivially copyable and
+ * ordering and equality are plain integer compares.
  */
 class tSymbol
 {
@@ -75,52 +91,70 @@ class tSymbol
 //----------------------------------------------------------------------
 public:
 
-  std::string cSYMBOL;
-  const int cEXPONENTS[cNUMBER_OF_BASIC_DIMENSIONS];
-
   template <typename TUnit>
   tSymbol(TUnit unit, const std::string &symbol) :
-    cSYMBOL(symbol),
-    cEXPONENTS {TUnit::cLENGTH, TUnit::cMASS, TUnit::cTIME, TUnit::cELECTRIC_CURRENT, TUnit::cTEMPERATURE, TUnit::cAMOUNT_OF_SUBSTANCE, TUnit::cLUMINOUS_INTENSITY}
+    symbol(internal::InternSymbolString(symbol)),
+    dimension(unit),
+    order(ComputeOrder(this->dimension))
   {}
 
-};
+  inline const std::string &String() const
+  {
+    return *this->symbol;
+  }
 
-inline bool operator == (const tSymbol &left, const tSymbol &right)
-{
-  for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
+  inline tDimension Dimension() const
   {
-    if (left.cEXPONENTS[i] != right.cEXPONENTS[i])
-    {
-      return false;
-    }
+    return this->dimension;
   }
-  return left.cSYMBOL == right.cSYMBOL;
-}
 
-inline bool operator < (const tSymbol &left, const tSymbol &right)
-{
-  int left_exponents = 0;
-  int right_exponents = 0;
-  for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
+  inline int Exponent(size_t index) const
   {
-    left_exponents += abs(left.cEXPONENTS[i]);
-    right_exponents += abs(right.cEXPONENTS[i]);
+    return this->dimension.Exponent(index);
   }
-  if (left_exponents != right_exponents)
+
+  /*!
+   * Key that orders symbols by the sum of their absolute exponents
+   * and then lexicographically by the absolute exponents
+   */
+  inline uint64_t Order() const
   {
-    return left_exponents < right_exponents;
+    return this->order;
   }
 
-  for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  const std::string *symbol;
+  tDimension dimension;
+  uint64_t order;
+
+  static uint64_t ComputeOrder(tDimension dimension)
   {
-    if (abs(left.cEXPONENTS[i]) != abs(right.cEXPONENTS[i]))
+    // sum of the absolute exponents (at most 7 * 127, remaining 15 bits) above 7 * 7 bits for the exponents themselves
+    uint64_t sum = 0;
+    uint64_t exponents = 0;
+    for (size_t i = 0; i < cNUMBER_OF_BASIC_DIMENSIONS; ++i)
     {
-      return abs(left.cEXPONENTS[i]) < abs(right.cEXPONENTS[i]);
+      uint64_t absolute_exponent = std::min(127, std::abs(dimension.Exponent(i)));
+      sum += absolute_exponent;
+      exponents = (exponents << 7) | absolute_exponent;
     }
+    return (sum << (7 * cNUMBER_OF_BASIC_DIMENSIONS)) | exponents;
   }
 
-  return false;
+};
+
+inline bool operator == (const tSymbol &left, const tSymbol &right)
+{
+  return left.Dimension() == right.Dimension() && &left.String() == &right.String();
+}
+
+inline bool operator < (const tSymbol &left, const tSymbol &right)
+{
+  return left.Order() < right.Order();
 }
 
 //----------------------------------------------------------------------
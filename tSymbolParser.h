@@ -88,6 +88,15 @@ double GetFactorToBaseUnit(const std::string& symbol_string, const std::string&
 template <typename TUnit>
 struct tSymbolParser
 {
+  /*!
+   * Symbol that accepts SI prefixes (e.g. "m" for length, "g" for mass).
+   * The default implementation has none, so nullptr is returned.
+   */
+  static const char *PrefixableBaseSymbol()
+  {
+    return nullptr;
+  }
+
   /*!
    * Check whether the provided string is a supported symbol string for this unit.
    * Throws a std::runtime_error if this is not the case.
@@ -111,72 +120,225 @@ struct tSymbolParser
 template <>
 struct tSymbolParser<tSIUnit<1, 0, 0, 0, 0, 0, 0>> // meter
 {
+  static const char *PrefixableBaseSymbol()
+  {
+    return "m";
+  }
+
   static double GetFactorToBaseUnit(const std::string& symbol_string)
   {
-    return internal::GetFactorToBaseUnit(symbol_string, "m");
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol());
   }
 };
 
 template <>
 struct tSymbolParser<tSIUnit<0, 1, 0, 0, 0, 0, 0>> // kilogram
 {
+  static const char *PrefixableBaseSymbol()
+  {
+    return "g";
+  }
+
   static double GetFactorToBaseUnit(const std::string& symbol_string)
   {
-    return 0.001 * internal::GetFactorToBaseUnit(symbol_string, "g", { tCustomSymbol("t", 1000000) });
+    return 0.001 * internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol(), { tCustomSymbol("t", 1000000) });
   }
 };
 
 template <>
 struct tSymbolParser<tSIUnit<0, 0, 1, 0, 0, 0, 0>> // second
 {
+  static const char *PrefixableBaseSymbol()
+  {
+    return "s";
+  }
+
   static double GetFactorToBaseUnit(const std::string& symbol_string)
   {
-    return internal::GetFactorToBaseUnit(symbol_string, "s", { tCustomSymbol("h", 3600) });
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol(), { tCustomSymbol("h", 3600) });
   }
 };
 
 template <>
 struct tSymbolParser<tSIUnit<0, 0, 0, 1, 0, 0, 0>> // ampere
 {
+  static const char *PrefixableBaseSymbol()
+  {
+    return "A";
+  }
+
   static double GetFactorToBaseUnit(const std::string& symbol_string)
   {
-    return internal::GetFactorToBaseUnit(symbol_string, "A");
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol());
   }
 };
 
 template <>
 struct tSymbolParser < tSIUnit < 0, 0, -1, 0, 0, 0, 0 >> // hertz
 {
+  static const char *PrefixableBaseSymbol()
+  {
+    return "Hz";
+  }
+
   static double GetFactorToBaseUnit(const std::string& symbol_string)
   {
-    return internal::GetFactorToBaseUnit(symbol_string, "Hz", { tCustomSymbol("1/s", 1) });
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol(), { tCustomSymbol("1/s", 1) });
   }
 };
 
 template <>
 struct tSymbolParser < tSIUnit < 1, 1, -2, 0, 0, 0, 0 >> // newton
 {
+  static const char *PrefixableBaseSymbol()
+  {
+    return "N";
+  }
+
   static double GetFactorToBaseUnit(const std::string& symbol_string)
   {
-    return internal::GetFactorToBaseUnit(symbol_string, "N");
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol());
   }
 };
 
 template <>
 struct tSymbolParser < tSIUnit < -1, 1, -2, 0, 0, 0, 0 >> // pascal
 {
+  static const char *PrefixableBaseSymbol()
+  {
+    return "Pa";
+  }
+
   static double GetFactorToBaseUnit(const std::string& symbol_string)
   {
-    return internal::GetFactorToBaseUnit(symbol_string, "Pa");
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol());
+  }
+};
+
+template <>
+struct tSymbolParser < tSIUnit < 2, 1, -2, 0, 0, 0, 0 >> // joule
+{
+  // energy and torque share this dimension and print as Nm, so there is no prefixed output
+  static const char *PrefixableBaseSymbol()
+  {
+    return nullptr;
+  }
+
+  static double GetFactorToBaseUnit(const std::string& symbol_string)
+  {
+    return internal::GetFactorToBaseUnit(symbol_string, "J", { tCustomSymbol("Nm", 1), tCustomSymbol("Ws", 1), tCustomSymbol("Wh", 3600), tCustomSymbol("kWh", 3600000) });
+  }
+};
+
+template <>
+struct tSymbolParser < tSIUnit < 2, 1, -3, 0, 0, 0, 0 >> // watt
+{
+  static const char *PrefixableBaseSymbol()
+  {
+    return "W";
+  }
+
+  static double GetFactorToBaseUnit(const std::string& symbol_string)
+  {
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol());
+  }
+};
+
+template <>
+struct tSymbolParser < tSIUnit < 0, 0, 1, 1, 0, 0, 0 >> // coulomb
+{
+  static const char *PrefixableBaseSymbol()
+  {
+    return "C";
+  }
+
+  static double GetFactorToBaseUnit(const std::string& symbol_string)
+  {
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol(), { tCustomSymbol("As", 1), tCustomSymbol("Ah", 3600), tCustomSymbol("mAh", 3.6) });
+  }
+};
+
+template <>
+struct tSymbolParser < tSIUnit < 2, 1, -3, -1, 0, 0, 0 >> // volt
+{
+  static const char *PrefixableBaseSymbol()
+  {
+    return "V";
+  }
+
+  static double GetFactorToBaseUnit(const std::string& symbol_string)
+  {
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol());
+  }
+};
+
+template <>
+struct tSymbolParser < tSIUnit < -2, -1, 4, 2, 0, 0, 0 >> // farad
+{
+  static const char *PrefixableBaseSymbol()
+  {
+    return "F";
+  }
+
+  static double GetFactorToBaseUnit(const std::string& symbol_string)
+  {
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol());
+  }
+};
+
+template <>
+struct tSymbolParser < tSIUnit < 2, 1, -3, -2, 0, 0, 0 >> // ohm
+{
+  static const char *PrefixableBaseSymbol()
+  {
+    return "Ω";
+  }
+
+  static double GetFactorToBaseUnit(const std::string& symbol_string)
+  {
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol(), { tCustomSymbol("Ohm", 1) });
+  }
+};
+
+template <>
+struct tSymbolParser < tSIUnit < 2, 1, -2, -1, 0, 0, 0 >> // weber
+{
+  static const char *PrefixableBaseSymbol()
+  {
+    return "Wb";
+  }
+
+  static double GetFactorToBaseUnit(const std::string& symbol_string)
+  {
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol());
+  }
+};
+
+template <>
+struct tSymbolParser < tSIUnit < 0, 1, -2, -1, 0, 0, 0 >> // tesla
+{
+  static const char *PrefixableBaseSymbol()
+  {
+    return "T";
+  }
+
+  static double GetFactorToBaseUnit(const std::string& symbol_string)
+  {
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol());
   }
 };
 
 template <>
 struct tSymbolParser < tSIUnit < 1, 0, -1, 0, 0, 0, 0 >> // velocity
 {
+  static const char *PrefixableBaseSymbol()
+  {
+    return "m/s";
+  }
+
   static double GetFactorToBaseUnit(const std::string& symbol_string)
   {
-    return internal::GetFactorToBaseUnit(symbol_string, "m/s", { tCustomSymbol("km/h", 1 / 3.6) });
+    return internal::GetFactorToBaseUnit(symbol_string, PrefixableBaseSymbol(), { tCustomSymbol("km/h", 1 / 3.6) });
   }
 };
 
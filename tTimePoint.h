@@ -0,0 +1,269 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tTimePoint.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tTimePoint
+ *
+ * \b tTimePoint
+ *
+ * An affine point in time that stores the integer ticks of a std::chrono
+ * duration with compile-time period. Differences of time points are
+ * durations, and durations or time quantities can be added to time points.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tTimePoint_h__
+#define __rrlib__si_units__tTimePoint_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <chrono>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tQuantity.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Point in time
+/*!
+ * Stores the time since the epoch of TClock as TDuration (by default the
+ * clock's native integer tick type), so that conversions from and to
+ * std::chrono::time_point of the same clock are exact and never go through
+ * a floating point representation.
+ */
+template <typename TClock = std::chrono::steady_clock, typename TDuration = typename TClock::duration>
+class tTimePoint
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TClock tClock;
+  typedef TDuration tDuration;
+
+  tTimePoint()
+    : time_since_epoch(TDuration::zero())
+  {}
+
+  explicit tTimePoint(TDuration time_since_epoch)
+    : time_since_epoch(time_since_epoch)
+  {}
+
+  template <typename TOtherDuration>
+  tTimePoint(std::chrono::time_point<TClock, TOtherDuration> time_point)
+    : time_since_epoch(std::chrono::duration_cast<TDuration>(time_point.time_since_epoch()))
+  {}
+
+  template <typename TOtherDuration>
+  explicit inline operator std::chrono::time_point<TClock, TOtherDuration>() const
+  {
+    return std::chrono::time_point<TClock, TOtherDuration>(std::chrono::duration_cast<TOtherDuration>(this->time_since_epoch));
+  }
+
+  static tTimePoint Now()
+  {
+    return tTimePoint(TClock::now());
+  }
+
+  inline TDuration TimeSinceEpoch() const
+  {
+    return this->time_since_epoch;
+  }
+
+  template <typename TRep, typename TPeriod>
+  tTimePoint &operator += (std::chrono::duration<TRep, TPeriod> duration)
+  {
+    this->time_since_epoch += std::chrono::duration_cast<TDuration>(duration);
+    return *this;
+  }
+
+  template <typename TRep, typename TPeriod>
+  tTimePoint &operator -= (std::chrono::duration<TRep, TPeriod> duration)
+  {
+    this->time_since_epoch -= std::chrono::duration_cast<TDuration>(duration);
+    return *this;
+  }
+
+  template <typename TValue>
+  tTimePoint &operator += (tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> time)
+  {
+    this->time_since_epoch += static_cast<TDuration>(time);
+    return *this;
+  }
+
+  template <typename TValue>
+  tTimePoint &operator -= (tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> time)
+  {
+    this->time_since_epoch -= static_cast<TDuration>(time);
+    return *this;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  TDuration time_since_epoch;
+
+};
+
+//----------------------------------------------------------------------
+// Addition
+//----------------------------------------------------------------------
+template <typename TClock, typename TDuration, typename TOffset>
+tTimePoint<TClock, TDuration> operator + (tTimePoint<TClock, TDuration> time_point, TOffset offset)
+{
+  time_point += offset;
+  return time_point;
+}
+
+template <typename TClock, typename TDuration, typename TRep, typename TPeriod>
+tTimePoint<TClock, TDuration> operator + (std::chrono::duration<TRep, TPeriod> duration, tTimePoint<TClock, TDuration> time_point)
+{
+  return time_point + duration;
+}
+
+template <typename TClock, typename TDuration, typename TValue>
+tTimePoint<TClock, TDuration> operator + (tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>, TValue> time, tTimePoint<TClock, TDuration> time_point)
+{
+  return time_point + time;
+}
+
+//----------------------------------------------------------------------
+// Subtraction
+//----------------------------------------------------------------------
+template <typename TClock, typename TDuration>
+TDuration operator - (tTimePoint<TClock, TDuration> left, tTimePoint<TClock, TDuration> right)
+{
+  return left.TimeSinceEpoch() - right.TimeSinceEpoch();
+}
+
+template <typename TClock, typename TDuration, typename TOffset>
+tTimePoint<TClock, TDuration> operator - (tTimePoint<TClock, TDuration> time_point, TOffset offset)
+{
+  time_point -= offset;
+  return time_point;
+}
+
+//----------------------------------------------------------------------
+// Comparison
+//----------------------------------------------------------------------
+template <typename TClock, typename TDuration>
+const bool operator == (tTimePoint<TClock, TDuration> left, tTimePoint<TClock, TDuration> right)
+{
+  return left.TimeSinceEpoch() == right.TimeSinceEpoch();
+}
+
+template <typename TClock, typename TDuration>
+const bool operator != (tTimePoint<TClock, TDuration> left, tTimePoint<TClock, TDuration> right)
+{
+  return !(left == right);
+}
+
+template <typename TClock, typename TDuration>
+const bool operator < (tTimePoint<TClock, TDuration> left, tTimePoint<TClock, TDuration> right)
+{
+  return left.TimeSinceEpoch() < right.TimeSinceEpoch();
+}
+
+template <typename TClock, typename TDuration>
+const bool operator > (tTimePoint<TClock, TDuration> left, tTimePoint<TClock, TDuration> right)
+{
+  return left.TimeSinceEpoch() > right.TimeSinceEpoch();
+}
+
+template <typename TClock, typename TDuration>
+const bool operator <= (tTimePoint<TClock, TDuration> left, tTimePoint<TClock, TDuration> right)
+{
+  return !(left > right);
+}
+
+template <typename TClock, typename TDuration>
+const bool operator >= (tTimePoint<TClock, TDuration> left, tTimePoint<TClock, TDuration> right)
+{
+  return !(left < right);
+}
+
+//----------------------------------------------------------------------
+// Streaming
+//----------------------------------------------------------------------
+template <typename TClock, typename TDuration>
+std::ostream &operator << (std::ostream &stream, tTimePoint<TClock, TDuration> time_point)
+{
+  stream << tQuantity<tSIUnit<0, 0, 1, 0, 0, 0, 0>>(time_point.TimeSinceEpoch());
+  return stream;
+}
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+template <typename TClock, typename TDuration>
+inline serialization::tOutputStream& operator << (serialization::tOutputStream &stream, tTimePoint<TClock, TDuration> time_point)
+{
+  stream << time_point.TimeSinceEpoch().count();
+  return stream;
+}
+
+template <typename TClock, typename TDuration>
+inline serialization::tInputStream& operator >> (serialization::tInputStream &stream, tTimePoint<TClock, TDuration> &time_point)
+{
+  typename TDuration::rep ticks;
+  stream >> ticks;
+  time_point = tTimePoint<TClock, TDuration>(TDuration(ticks));
+  return stream;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,286 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tTimeSeriesFile.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const char cTIME_SERIES_MAGIC[8] = { 'R', 'R', 'S', 'I', 'U', 'T', 'S', '1' };
+const uint32_t cTIME_SERIES_VERSION = 1;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+//----------------------------------------------------------------------
+// WriteFully
+//----------------------------------------------------------------------
+void WriteFully(int file_descriptor, const char *data, size_t size, off_t offset)
+{
+  while (size > 0)
+  {
+    ssize_t written = pwrite(file_descriptor, data, size, offset);
+    if (written < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      throw std::runtime_error(std::string("Could not write time series file: ") + std::strerror(errno));
+    }
+    data += written;
+    size -= written;
+    offset += written;
+  }
+}
+
+//----------------------------------------------------------------------
+// ReadFully
+//----------------------------------------------------------------------
+bool ReadFully(int file_descriptor, char *data, size_t size, off_t offset)
+{
+  while (size > 0)
+  {
+    ssize_t read = pread(file_descriptor, data, size, offset);
+    if (read < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (read <= 0)
+    {
+      return false;
+    }
+    data += read;
+    size -= read;
+    offset += read;
+  }
+  return true;
+}
+
+}
+
+//----------------------------------------------------------------------
+// CreateTimeSeriesHeader
+//----------------------------------------------------------------------
+tTimeSeriesHeader CreateTimeSeriesHeader(tSerializationTag tag, uint8_t value_size, uint32_t block_capacity)
+{
+  tTimeSeriesHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, cTIME_SERIES_MAGIC, sizeof(header.magic));
+  header.version = cTIME_SERIES_VERSION;
+  header.block_capacity = block_capacity;
+  header.dimension = tag.Dimension().Packed();
+  header.value_type = tag.ValueType();
+  header.value_size = value_size;
+  return header;
+}
+
+//----------------------------------------------------------------------
+// CheckTimeSeriesHeader
+//----------------------------------------------------------------------
+const char *CheckTimeSeriesHeader(const char *data, size_t size, const tTimeSeriesHeader &expected)
+{
+  tTimeSeriesHeader header;
+  if (size < sizeof(header))
+  {
+    return "File is too small for a time series header";
+  }
+  std::memcpy(&header, data, sizeof(header));
+  if (std::memcmp(header.magic, cTIME_SERIES_MAGIC, sizeof(header.magic)) != 0)
+  {
+    return "Not a time series file";
+  }
+  if (header.version != cTIME_SERIES_VERSION)
+  {
+    return "Unsupported time series file version";
+  }
+  if (header.block_capacity == 0)
+  {
+    return "Invalid block capacity";
+  }
+  if (header.dimension != expected.dimension)
+  {
+    return "Time series has another unit";
+  }
+  if (header.value_type != expected.value_type || header.value_size != expected.value_size)
+  {
+    return "Time series has another value type";
+  }
+  return nullptr;
+}
+
+//----------------------------------------------------------------------
+// tTimeSeriesFileWriter constructor
+//----------------------------------------------------------------------
+tTimeSeriesFileWriter::tTimeSeriesFileWriter(const std::string &file_name, const tTimeSeriesHeader &header) :
+  file_descriptor(open(file_name.c_str(), O_RDWR | O_CREAT, 0644)),
+  header(header),
+  value_offset(0),
+  block_index(0),
+  block_fill(0)
+{
+  if (this->file_descriptor < 0)
+  {
+    throw std::runtime_error("Could not open '" + file_name + "': " + std::strerror(errno));
+  }
+
+  struct stat file_status;
+  if (fstat(this->file_descriptor, &file_status) != 0)
+  {
+    close(this->file_descriptor);
+    throw std::runtime_error("Could not stat '" + file_name + "': " + std::strerror(errno));
+  }
+
+  if (file_status.st_size == 0)
+  {
+    if (header.block_capacity == 0)
+    {
+      close(this->file_descriptor);
+      throw std::runtime_error("Block capacity must not be zero");
+    }
+    WriteFully(this->file_descriptor, reinterpret_cast<const char *>(&this->header), sizeof(this->header), 0);
+  }
+  else
+  {
+    // continue existing file with its own block capacity
+    const char *error_message = nullptr;
+    if (!ReadFully(this->file_descriptor, reinterpret_cast<char *>(&this->header), std::min<size_t>(sizeof(this->header), file_status.st_size), 0))
+    {
+      error_message = "Could not read header";
+    }
+    error_message = error_message ? error_message : CheckTimeSeriesHeader(reinterpret_cast<const char *>(&this->header), file_status.st_size, header);
+    if (error_message)
+    {
+      close(this->file_descriptor);
+      throw std::runtime_error(file_name + ": " + error_message);
+    }
+  }
+
+  this->value_offset = TimeSeriesValueOffset(this->header);
+  this->block.assign(TimeSeriesBlockSize(this->header), 0);
+
+  size_t number_of_blocks = (file_status.st_size > static_cast<off_t>(sizeof(this->header))) ? (file_status.st_size - sizeof(this->header)) / this->block.size() : 0;
+  if (number_of_blocks > 0)
+  {
+    // load last block if it is not full
+    uint64_t fill = 0;
+    off_t offset = sizeof(this->header) + (number_of_blocks - 1) * this->block.size();
+    ReadFully(this->file_descriptor, reinterpret_cast<char *>(&fill), sizeof(fill), offset);
+    if (fill < this->header.block_capacity)
+    {
+      ReadFully(this->file_descriptor, this->block.data(), this->block.size(), offset);
+      this->block_index = number_of_blocks - 1;
+      this->block_fill = fill;
+    }
+    else
+    {
+      this->block_index = number_of_blocks;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tTimeSeriesFileWriter destructor
+//----------------------------------------------------------------------
+tTimeSeriesFileWriter::~tTimeSeriesFileWriter()
+{
+  try
+  {
+    this->Flush();
+  }
+  catch (const std::runtime_error &)
+  {}
+  close(this->file_descriptor);
+}
+
+//----------------------------------------------------------------------
+// tTimeSeriesFileWriter Flush
+//----------------------------------------------------------------------
+void tTimeSeriesFileWriter::Flush()
+{
+  if (this->block_fill > 0)
+  {
+    this->WriteBlock();
+  }
+}
+
+//----------------------------------------------------------------------
+// tTimeSeriesFileWriter WriteBlock
+//----------------------------------------------------------------------
+void tTimeSeriesFileWriter::WriteBlock()
+{
+  std::memcpy(this->block.data(), &this->block_fill, sizeof(this->block_fill));
+  WriteFully(this->file_descriptor, this->block.data(), this->block.size(), sizeof(this->header) + this->block_index * this->block.size());
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
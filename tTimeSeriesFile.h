@@ -0,0 +1,332 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tTimeSeriesFile.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tTimeSeriesWriter and tTimeSeriesReader
+ *
+ * \b tTimeSeriesWriter / tTimeSeriesReader
+ *
+ * A self-describing file format for time series of one quantity type.
+ *
+ * Layout (native byte order, every part aligned to 64 bytes):
+ *   header   magic "RRSIUTS1", version, block capacity, packed dimension
+ *            (unit exponents), value type id and value size
+ *   block 0  number of samples, timestamps (int64 ns since the clock's epoch),
+ *            values (raw tQuantity values)
+ *   block 1  ...
+ *
+ * All blocks have the same size, so block i is found in O(1). The writer
+ * only touches the last block, so appending is O(1) as well. The reader
+ * memory-maps the file and exposes blocks as typed arrays without copying.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__si_units__include_guard__
+#error Invalid include directive. Try #include "rrlib/si_units/si_units.h" instead.
+#endif
+
+#ifndef __rrlib__si_units__tTimeSeriesFile_h__
+#define __rrlib__si_units__tTimeSeriesFile_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/si_units/tQuantity.h"
+#include "rrlib/si_units/tTimePoint.h"
+#include "rrlib/si_units/tSerializationTag.h"
+#include "rrlib/si_units/tMemoryMappedFile.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Default number of samples per block of time series files */
+const uint32_t cDEFAULT_TIME_SERIES_BLOCK_CAPACITY = 4096;
+
+namespace internal
+{
+
+const size_t cTIME_SERIES_ALIGNMENT = 64;
+
+/*! File header of time series files (64 bytes) */
+struct tTimeSeriesHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t block_capacity;
+  uint64_t dimension;
+  uint8_t value_type;
+  uint8_t value_size;
+  uint8_t reserved[38];
+};
+
+static_assert(sizeof(tTimeSeriesHeader) == cTIME_SERIES_ALIGNMENT, "Header must fill exactly one alignment unit");
+
+tTimeSeriesHeader CreateTimeSeriesHeader(tSerializationTag tag, uint8_t value_size, uint32_t block_capacity);
+
+/*!
+ * Checks the header at the beginning of data against the expected one (block capacity is not compared)
+ *
+ * \return nullptr on success, otherwise a static error message
+ */
+const char *CheckTimeSeriesHeader(const char *data, size_t size, const tTimeSeriesHeader &expected);
+
+inline size_t AlignTimeSeriesOffset(size_t offset)
+{
+  return (offset + cTIME_SERIES_ALIGNMENT - 1) & ~(cTIME_SERIES_ALIGNMENT - 1);
+}
+
+inline size_t TimeSeriesValueOffset(const tTimeSeriesHeader &header)
+{
+  return cTIME_SERIES_ALIGNMENT + AlignTimeSeriesOffset(header.block_capacity * sizeof(int64_t));
+}
+
+inline size_t TimeSeriesBlockSize(const tTimeSeriesHeader &header)
+{
+  return TimeSeriesValueOffset(header) + AlignTimeSeriesOffset(header.block_capacity * header.value_size);
+}
+
+/*!
+ * Untyped part of tTimeSeriesWriter.
+ * Keeps the last block in memory and writes it to the file when it is full or on Flush().
+ */
+class tTimeSeriesFileWriter
+{
+public:
+
+  /*!
+   * Creates the file or opens it for appending.
+   * Throws a std::runtime_error if the file cannot be opened or holds another quantity type.
+   */
+  tTimeSeriesFileWriter(const std::string &file_name, const tTimeSeriesHeader &header);
+
+  ~tTimeSeriesFileWriter();
+
+  tTimeSeriesFileWriter(const tTimeSeriesFileWriter &) = delete;
+  tTimeSeriesFileWriter &operator = (const tTimeSeriesFileWriter &) = delete;
+
+  inline void Append(int64_t timestamp, const void *value)
+  {
+    std::memcpy(this->block.data() + cTIME_SERIES_ALIGNMENT + this->block_fill * sizeof(int64_t), &timestamp, sizeof(int64_t));
+    std::memcpy(this->block.data() + this->value_offset + this->block_fill * this->header.value_size, value, this->header.value_size);
+    ++this->block_fill;
+    if (this->block_fill == this->header.block_capacity)
+    {
+      this->WriteBlock();
+      ++this->block_index;
+      this->block_fill = 0;
+      std::memset(this->block.data(), 0, this->block.size());
+    }
+  }
+
+  /*!
+   * Writes the partially filled last block to the file
+   */
+  void Flush();
+
+  inline uint64_t NumberOfSamples() const
+  {
+    return this->block_index * this->header.block_capacity + this->block_fill;
+  }
+
+private:
+
+  int file_descriptor;
+  tTimeSeriesHeader header;
+  size_t value_offset;
+  std::vector<char> block;
+  uint64_t block_index;
+  uint64_t block_fill;
+
+  void WriteBlock();
+};
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Appends samples of TQuantity to a time series file
+/*!
+ * The constructor creates the file or continues an existing one and throws a
+ * std::runtime_error on failure. Complete blocks are written as soon as they
+ * are full; the last block is written by Flush() and by the destructor.
+ */
+template <typename TQuantity, typename TClock = std::chrono::system_clock>
+class tTimeSeriesWriter
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tTimePoint<TClock, std::chrono::nanoseconds> tTimestamp;
+
+  explicit tTimeSeriesWriter(const std::string &file_name, uint32_t block_capacity = cDEFAULT_TIME_SERIES_BLOCK_CAPACITY)
+    : writer(file_name, internal::CreateTimeSeriesHeader(GetSerializationTag<TQuantity>(), sizeof(TQuantity), block_capacity))
+  {}
+
+  inline void Append(tTimestamp timestamp, TQuantity value)
+  {
+    this->writer.Append(timestamp.TimeSinceEpoch().count(), &value);
+  }
+
+  inline void Flush()
+  {
+    this->writer.Flush();
+  }
+
+  inline uint64_t NumberOfSamples() const
+  {
+    return this->writer.NumberOfSamples();
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  internal::tTimeSeriesFileWriter writer;
+
+};
+
+//! Zero-copy reader of time series files
+/*!
+ * Memory-maps the file and checks its header against TQuantity. The
+ * constructor throws a std::runtime_error if the file cannot be mapped or holds
+ * another quantity type. Blocks are typed views into the mapping and stay
+ * valid for the lifetime of the reader.
+ */
+template <typename TQuantity, typename TClock = std::chrono::system_clock>
+class tTimeSeriesReader
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tTimePoint<TClock, std::chrono::nanoseconds> tTimestamp;
+
+  struct tBlock
+  {
+    const tTimestamp *timestamps;
+    const TQuantity *values;
+    size_t size;
+  };
+
+  explicit tTimeSeriesReader(const std::string &file_name)
+    : file(file_name),
+      header(internal::CreateTimeSeriesHeader(GetSerializationTag<TQuantity>(), sizeof(TQuantity), 0))
+  {
+    static_assert(sizeof(tTimestamp) == sizeof(int64_t) && std::is_standard_layout<tTimestamp>::value, "tTimePoint must have the layout of its tick count");
+    static_assert(sizeof(TQuantity) == sizeof(typename TQuantity::tValue) && std::is_standard_layout<TQuantity>::value, "tQuantity must have the layout of its value");
+    if (!this->file.IsOpen())
+    {
+      throw std::runtime_error(this->file.ErrorMessage());
+    }
+    const char *error_message = internal::CheckTimeSeriesHeader(this->file.Data(), this->file.Size(), this->header);
+    if (error_message)
+    {
+      throw std::runtime_error(file_name + ": " + error_message);
+    }
+    std::memcpy(&this->header, this->file.Data(), sizeof(this->header));
+    this->block_size = internal::TimeSeriesBlockSize(this->header);
+    this->number_of_blocks = (this->file.Size() - sizeof(this->header)) / this->block_size;
+  }
+
+  inline size_t NumberOfBlocks() const
+  {
+    return this->number_of_blocks;
+  }
+
+  inline size_t BlockCapacity() const
+  {
+    return this->header.block_capacity;
+  }
+
+  inline tBlock Block(size_t index) const
+  {
+    const char *data = this->file.Data() + sizeof(this->header) + index * this->block_size;
+    uint64_t size;
+    std::memcpy(&size, data, sizeof(size));
+    return tBlock
+    {
+      reinterpret_cast<const tTimestamp *>(data + internal::cTIME_SERIES_ALIGNMENT),
+      reinterpret_cast<const TQuantity *>(data + internal::TimeSeriesValueOffset(this->header)),
+      static_cast<size_t>(std::min<uint64_t>(size, this->header.block_capacity))
+    };
+  }
+
+  /*!
+   * Total number of samples (all blocks but the last are full)
+   */
+  inline size_t NumberOfSamples() const
+  {
+    return this->number_of_blocks == 0 ? 0 : (this->number_of_blocks - 1) * this->header.block_capacity + this->Block(this->number_of_blocks - 1).size;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tMemoryMappedFile file;
+  internal::tTimeSeriesHeader header;
+  size_t block_size;
+  size_t number_of_blocks;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
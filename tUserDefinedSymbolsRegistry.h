@@ -43,6 +43,8 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <ios>
 
@@ -89,16 +91,28 @@ public:
   }
 
   tUserDefinedSymbolsRegistry()
+    : generation(0)
   {}
 
   inline void Register(const tSymbol &symbol)
   {
     this->global_symbols.push_back(symbol);
+    this->generation.fetch_add(1, std::memory_order_release);
   }
 
   inline void Unregister(const tSymbol &symbol)
   {
     this->global_symbols.remove(symbol);
+    this->generation.fetch_add(1, std::memory_order_release);
+  }
+
+  /*!
+   * \return Counter that changes whenever the global symbols change
+   * (may be read from any thread, e.g. by the per-thread decomposition caches)
+   */
+  inline uint64_t Generation() const
+  {
+    return this->generation.load(std::memory_order_acquire);
   }
 
   inline const std::list<tSymbol> &GlobalSymbols() const
@@ -144,6 +158,7 @@ public:
 private:
 
   std::list<tSymbol> global_symbols;
+  std::atomic<uint64_t> generation;
   std::vector<std::list<tSymbol>> persistent_stream_symbols;
   std::vector<std::list<tSymbol>> temporary_stream_symbols;
 
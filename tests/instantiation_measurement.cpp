@@ -0,0 +1,102 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tests/instantiation_measurement.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Typical translation unit using the common quantity types. It is built
+ * by measure_instantiations.sh with and without extern templates to show
+ * their effect on compile time and object size.
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <iostream>
+#include <sstream>
+
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::si_units;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+template <typename TQuantity>
+void Use(std::ostream &stream, TQuantity a, TQuantity b)
+{
+  typedef typename TQuantity::tValue tValue;
+  TQuantity sum = a + b;
+  TQuantity difference = a - b;
+  TQuantity scaled = a * tValue(2) / tValue(3);
+  stream << sum << " " << difference << " " << -scaled << " " << (a < b) << (a == b) << (a >= b) << std::endl;
+  std::stringstream symbol;
+  symbol << typename TQuantity::tUnit();
+  stream << GetCachedFactorToBaseUnit<typename TQuantity::tUnit>(symbol.str()) << std::endl;
+}
+
+template <typename ... TQuantities>
+void UseAll(std::ostream &stream)
+{
+  int expand[] = { (Use(stream, TQuantities(1), TQuantities(2)), 0)... };
+  (void)expand;
+}
+
+//----------------------------------------------------------------------
+// main
+//----------------------------------------------------------------------
+int main()
+{
+  std::stringstream stream;
+  UseAll<tLength<double>, tLength<float>, tMass<double>, tMass<float>, tTime<double>, tTime<float>,
+         tElectricCurrent<double>, tElectricCurrent<float>, tTemperature<double>, tTemperature<float>,
+         tFrequency<double>, tFrequency<float>, tForce<double>, tForce<float>, tPressure<double>, tPressure<float>,
+         tEnergy<double>, tEnergy<float>, tPower<double>, tPower<float>, tVoltage<double>, tVoltage<float>,
+         tResistance<double>, tResistance<float>, tVelocity<double>, tVelocity<float>, tAcceleration<double>, tAcceleration<float>>(stream);
+  std::cout << stream.str().size() << std::endl;
+  return 0;
+}
@@ -0,0 +1,33 @@
+#!/bin/sh
+#
+# Compares compile time and object size of a typical translation unit
+# with and without the extern template declarations of rrlib_si_units.
+#
+# Usage: measure_instantiations.sh [repetitions]
+# Honours CXX (default g++) and CXXFLAGS, which must contain the include
+# paths of rrlib (e.g. CXXFLAGS="-std=c++11 -O2 -I/path/to/sources/cpp").
+#
+
+set -e
+
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--std=c++11 -O2}
+REPETITIONS=${1:-5}
+SOURCE=$(dirname "$0")/instantiation_measurement.cpp
+OUTPUT=$(mktemp -d)
+trap 'rm -rf "$OUTPUT"' EXIT
+
+measure()
+{
+  start=$(date +%s%N)
+  i=0
+  while [ $i -lt "$REPETITIONS" ]; do
+    $CXX $CXXFLAGS "$@" -c "$SOURCE" -o "$OUTPUT/measurement.o"
+    i=$((i + 1))
+  done
+  end=$(date +%s%N)
+  echo "$(( (end - start) / REPETITIONS / 1000000 )) ms per compile, $(wc -c < "$OUTPUT/measurement.o") bytes object"
+}
+
+echo "extern templates:    $(measure)"
+echo "local instantiation: $(measure -DRRLIB_SI_UNITS_NO_EXTERN_TEMPLATES)"
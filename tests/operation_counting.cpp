@@ -0,0 +1,122 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file    rrlib/si_units/tests/operation_counting.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-19
+ *
+ * Tests the operation counters with the hooks in the tQuantity operators
+ * enabled. This is a separate program, as RRLIB_SI_UNITS_COUNT_OPERATIONS
+ * has to be defined before si_units.h is included.
+ *
+ */
+//----------------------------------------------------------------------
+#define RRLIB_SI_UNITS_COUNT_OPERATIONS
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+#include <sstream>
+
+#include "rrlib/si_units/si_units.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace si_units
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+class TestOperationCounting : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestOperationCounting);
+  RRLIB_UNIT_TESTS_ADD_TEST(CountedOperators);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void CountedOperators()
+  {
+    ResetOperationCounts();
+
+    tLength<double> length(2);
+    tForce<double> force(3);
+    for (int i = 0; i < 4; ++i)
+    {
+      length = length + tLength<double>(1);
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(0.5, (force / length).Value());
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(tForce<>(6), force * 2.0);
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(4), length - tLength<double>(2));
+    length -= tLength<double>(1);
+
+    std::stringstream stream;
+    DumpOperationCounts(stream);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("m + m: 4\nN / m: 3\nm - m: 2\nN * 1: 1\n"), stream.str());
+
+    ResetOperationCounts();
+    stream.str("");
+    DumpOperationCounts(stream);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string(""), stream.str());
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestOperationCounting);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
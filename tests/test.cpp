@@ -33,10 +33,19 @@
 //----------------------------------------------------------------------
 #include "rrlib/util/tUnitTestSuite.h"
 
+#include <clocale>
+#include <thread>
 #include <type_traits>
 
 #include "rrlib/si_units/si_units.h"
 
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#define RRLIB_SI_UNITS_TEST_EXPERIMENTAL_SIMD
+#endif
+#endif
+
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
@@ -77,8 +86,33 @@ class TestSIUnits : public util::tUnitTestSuite
   RRLIB_UNIT_TESTS_ADD_TEST(Typedefs);
   RRLIB_UNIT_TESTS_ADD_TEST(Symbols);
   RRLIB_UNIT_TESTS_ADD_TEST(Streaming);
+  RRLIB_UNIT_TESTS_ADD_TEST(TaggedStreaming);
   RRLIB_UNIT_TESTS_ADD_TEST(Conversions);
+  RRLIB_UNIT_TESTS_ADD_TEST(IntegerConversions);
+  RRLIB_UNIT_TESTS_ADD_TEST(TimePoints);
   RRLIB_UNIT_TESTS_ADD_TEST(StringDeserialization);
+  RRLIB_UNIT_TESTS_ADD_TEST(ConversionFactorCache);
+  RRLIB_UNIT_TESTS_ADD_TEST(ColumnParsing);
+  RRLIB_UNIT_TESTS_ADD_TEST(BufferConversion);
+  RRLIB_UNIT_TESTS_ADD_TEST(AngleKernels);
+  RRLIB_UNIT_TESTS_ADD_TEST(QuantityMath);
+  RRLIB_UNIT_TESTS_ADD_TEST(ControlBlocks);
+  RRLIB_UNIT_TESTS_ADD_TEST(QuantityFrames);
+  RRLIB_UNIT_TESTS_ADD_TEST(TimeSeriesFiles);
+  RRLIB_UNIT_TESTS_ADD_TEST(ScopedSymbolContexts);
+  RRLIB_UNIT_TESTS_ADD_TEST(SimdValues);
+  RRLIB_UNIT_TESTS_ADD_TEST(Reductions);
+  RRLIB_UNIT_TESTS_ADD_TEST(QuantityStatistics);
+  RRLIB_UNIT_TESTS_ADD_TEST(RingBuffers);
+  RRLIB_UNIT_TESTS_ADD_TEST(QuantityOperations);
+  RRLIB_UNIT_TESTS_ADD_TEST(ColumnWriter);
+  RRLIB_UNIT_TESTS_ADD_TEST(Literals);
+  RRLIB_UNIT_TESTS_ADD_TEST(EngineeringNotationOutput);
+  RRLIB_UNIT_TESTS_ADD_TEST(OperationCounters);
+#if __cplusplus >= 202002L && defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+  RRLIB_UNIT_TESTS_ADD_TEST(CompileTimeSymbols);
+#endif
+  RRLIB_UNIT_TESTS_ADD_TEST(DynamicQuantities);
   RRLIB_UNIT_TESTS_END_SUITE;
 
 private:
@@ -150,6 +184,24 @@ private:
     stream.str("");
     stream << 1 / (tForce<>(1) * tLength<>(1));
     RRLIB_UNIT_TESTS_EQUALITY(std::string("1 1/Nm"), stream.str());
+
+    stream.str("");
+    stream << UseSymbol(tJoule(), "J", false) << tEnergy<>(1);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("1 J"), stream.str());
+
+    std::stringstream derived_stream;
+    derived_stream << tPressure<>(1) << ", " << tAcceleration<>(1) << ", " << tForce<>(1) / tLength<>(1) << ", " << tVoltage<>(1) / tElectricCurrent<>(1) << ", " << tPower<>(1) * tLength<>(1);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("1 Pa, 1 m/s^2, 1 kg/s^2, 1 Ω, 1 Wm"), derived_stream.str());
+
+    derived_stream.str("");
+    derived_stream << tElectricCurrent<>(1) * tTime<>(1) / tVoltage<>(1) << ", " << tMagneticFlux<>(1) / tLength<>(1) / tLength<>(1) << ", " << tEnergy<>(1) / tTemperature<>(1);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("1 F, 1 T, 1 Nm/K"), derived_stream.str());
+
+    RRLIB_UNIT_TESTS_ASSERT(std::is_trivially_copyable<tSymbol>::value);
+    RRLIB_UNIT_TESTS_ASSERT(tSymbol(tHertz(), "Hz") == tSymbol(tHertz(), std::string("H") + "z"));
+    RRLIB_UNIT_TESTS_ASSERT(!(tSymbol(tHertz(), "Hz") == tSymbol(tHertz(), "1/s")));
+    RRLIB_UNIT_TESTS_ASSERT(tSymbol(tMeter(), "m") < tSymbol(tNewton(), "N"));
+    RRLIB_UNIT_TESTS_ASSERT(tSymbol(tKilogram(), "kg") < tSymbol(tMeter(), "m"));
   }
 
   void Streaming()
@@ -171,6 +223,46 @@ private:
     RRLIB_UNIT_TESTS_EQUALITY(tForce<float>(20), force);
   }
 
+  void TaggedStreaming()
+  {
+    serialization::tMemoryBuffer memory_buffer;
+    serialization::tOutputStream output_stream(memory_buffer);
+    serialization::tInputStream input_stream(memory_buffer);
+
+    std::vector<tLength<double>> lengths = { tLength<double>(1), tLength<double>(2), tLength<double>(3) };
+    WriteQuantities(output_stream, lengths.data(), lengths.size());
+    WriteQuantities(output_stream, lengths.data(), lengths.size());
+    output_stream.Flush();
+
+    std::vector<tLength<double>> read_lengths;
+    ReadQuantities(input_stream, read_lengths);
+    RRLIB_UNIT_TESTS_ASSERT(lengths == read_lengths);
+    std::vector<tLength<float>> wrong_value_type;
+    RRLIB_UNIT_TESTS_EXCEPTION(ReadQuantities(input_stream, wrong_value_type), std::runtime_error);
+
+    serialization::tInputStream tagged_input_stream(memory_buffer);
+    ReadQuantities(tagged_input_stream, read_lengths);
+    std::vector<tTime<double>> wrong_unit;
+    RRLIB_UNIT_TESTS_EXCEPTION(ReadQuantities(tagged_input_stream, wrong_unit), std::runtime_error);
+
+    serialization::tMemoryBuffer corrupted_buffer;
+    serialization::tOutputStream corrupted_output_stream(corrupted_buffer);
+    serialization::tInputStream corrupted_input_stream(corrupted_buffer);
+    corrupted_output_stream << GetSerializationTag<tLength<double>>() << (uint64_t(1) << 40) << tLength<double>(1);
+    corrupted_output_stream.Flush();
+    RRLIB_UNIT_TESTS_EXCEPTION(ReadQuantities(corrupted_input_stream, read_lengths), std::exception);
+
+    serialization::tMemoryBuffer force_buffer;
+    serialization::tOutputStream force_output_stream(force_buffer);
+    serialization::tInputStream force_input_stream(force_buffer);
+    force_output_stream << GetSerializationTag<tForce<float>>() << tForce<float>(20);
+    force_output_stream.Flush();
+    tForce<float> force;
+    ReadAndCheckSerializationTag<tForce<float>>(force_input_stream);
+    force_input_stream >> force;
+    RRLIB_UNIT_TESTS_EQUALITY(tForce<float>(20), force);
+  }
+
   void Conversions()
   {
     time::tDuration duration(std::chrono::seconds(2));
@@ -190,6 +282,38 @@ private:
     RRLIB_UNIT_TESTS_EQUALITY(tTime<>(3), time::tDuration(std::chrono::seconds(5)) - time);
   }
 
+  void IntegerConversions()
+  {
+    tTime<int64_t> time(std::chrono::seconds(7));
+    RRLIB_UNIT_TESTS_EQUALITY(int64_t(7), time.Value());
+    RRLIB_UNIT_TESTS_EQUALITY(int64_t(7000000000), std::chrono::nanoseconds(time).count());
+    RRLIB_UNIT_TESTS_EQUALITY(tTime<int64_t>(9), time + std::chrono::seconds(2));
+    RRLIB_UNIT_TESTS_EQUALITY(tTime<int64_t>(4), std::chrono::seconds(11) - time);
+    RRLIB_UNIT_TESTS_EQUALITY(tTime<int64_t>(1), tTime<int64_t>(1) + std::chrono::milliseconds(5));
+    RRLIB_UNIT_TESTS_EQUALITY(600, (tLength<int>(3) / std::chrono::milliseconds(5)).Value());
+
+    std::chrono::nanoseconds large(std::chrono::hours(24 * 365 * 50) + std::chrono::nanoseconds(1));
+    RRLIB_UNIT_TESTS_EQUALITY(large.count(), std::chrono::nanoseconds(tTime<int64_t>(std::chrono::duration_cast<std::chrono::seconds>(large))).count() + 1);
+    RRLIB_UNIT_TESTS_EQUALITY(1.5, tTime<>(std::chrono::milliseconds(1500)).Value());
+  }
+
+  void TimePoints()
+  {
+    typedef tTimePoint<std::chrono::steady_clock> tSteadyTimePoint;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    tSteadyTimePoint time_point(now);
+    RRLIB_UNIT_TESTS_ASSERT(now == static_cast<std::chrono::steady_clock::time_point>(time_point));
+
+    tSteadyTimePoint later = time_point + std::chrono::nanoseconds(1);
+    RRLIB_UNIT_TESTS_EQUALITY(int64_t(1), std::chrono::nanoseconds(later - time_point).count());
+    RRLIB_UNIT_TESTS_ASSERT(time_point < later);
+
+    later += tTime<>(2);
+    RRLIB_UNIT_TESTS_EQUALITY(int64_t(2000000001), std::chrono::nanoseconds(later - time_point).count());
+    RRLIB_UNIT_TESTS_EQUALITY(tTime<>(2.000000001), tTime<>(later - time_point));
+    RRLIB_UNIT_TESTS_ASSERT(time_point == later - tTime<int64_t>(2) - std::chrono::nanoseconds(1));
+  }
+
   void StringDeserialization()
   {
     {
@@ -234,6 +358,767 @@ private:
       stream >> acceleration;
       RRLIB_UNIT_TESTS_EQUALITY(acceleration, tAcceleration<>(3));
     }
+    {
+      tEnergy<> energy;
+      serialization::tStringInputStream stream("2 kWh");
+      stream >> energy;
+      RRLIB_UNIT_TESTS_EQUALITY(energy, tEnergy<>(7200000));
+    }
+  }
+
+  void ConversionFactorCache()
+  {
+    tConversionFactorCache &cache = tConversionFactorCache::Instance();
+    cache.ResetStatistics();
+    RRLIB_UNIT_TESTS_EQUALITY(1E+3, GetCachedFactorToBaseUnit<tNewton>("kN"));
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(1), cache.Misses());
+    RRLIB_UNIT_TESTS_EQUALITY(1E+3, GetCachedFactorToBaseUnit<tNewton>("kN"));
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(1), cache.Hits());
+    RRLIB_UNIT_TESTS_EQUALITY(1 / 3.6, GetCachedFactorToBaseUnit<tVelocity<>::tUnit>("km/h"));
+
+    RRLIB_UNIT_TESTS_EQUALITY(cMILLI, GetCachedFactorToBaseUnit<tMeter>("mm"));
+    RRLIB_UNIT_TESTS_EQUALITY(cMILLI * cMILLI, GetCachedFactorToBaseUnit<tKilogram>("mg"));
+    RRLIB_UNIT_TESTS_EXCEPTION(GetCachedFactorToBaseUnit<tMeter>("parsec"), std::runtime_error);
+    RRLIB_UNIT_TESTS_EXCEPTION(GetCachedFactorToBaseUnit<tMeter>("parsec"), std::runtime_error);
+
+    // registering symbols starts a new generation of cached factors
+    RRLIB_UNIT_TESTS_ASSERT(cache.Size() > 1);
+    const tSymbol symbol(tNewton(), "kgm/s^2");
+    tUserDefinedSymbols::Instance().Register(symbol);
+    RRLIB_UNIT_TESTS_EQUALITY(1E+3, GetCachedFactorToBaseUnit<tNewton>("kN"));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(1), cache.Size());
+    tUserDefinedSymbols::Instance().Unregister(symbol);
+    RRLIB_UNIT_TESTS_EQUALITY(cMILLI, GetCachedFactorToBaseUnit<tMeter>("mm"));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(1), cache.Size());
+
+    // symbols of scoped contexts are only accepted in their thread
+    RRLIB_UNIT_TESTS_EXCEPTION(GetCachedFactorToBaseUnit<tKelvin>("degK"), std::runtime_error);
+    double factor_in_context = 0;
+    std::thread other_thread([&]()
+    {
+      tScopedSymbolContext context(tKelvin(), "degK");
+      factor_in_context = GetCachedFactorToBaseUnit<tKelvin>("degK");
+    });
+    other_thread.join();
+    RRLIB_UNIT_TESTS_EQUALITY(1.0, factor_in_context);
+    RRLIB_UNIT_TESTS_EXCEPTION(GetCachedFactorToBaseUnit<tKelvin>("degK"), std::runtime_error);
+    tTemperature<> temperature;
+    serialization::tStringInputStream temperature_stream("5 degK");
+    RRLIB_UNIT_TESTS_EXCEPTION(temperature_stream >> temperature, std::runtime_error);
+  }
+
+  void ColumnParsing()
+  {
+    std::string text = "time, distance\n0 s, 5 cm\n1 s, 3 km\n2 s, 4 parsec\n3 s,\n4 s, 7\r\n";
+    for (int i = 0; i < 100000; ++i)
+    {
+      text += "5 s, 12.5 mm\n";
+    }
+
+    std::vector<tLength<float>> lengths;
+    std::vector<tParseError> errors;
+    RRLIB_UNIT_TESTS_ASSERT(!ParseQuantityColumn(text.data(), text.size(), 1, lengths, errors, ',', 1, 4));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(100005), lengths.size());
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<float>(0.05), lengths[0]);
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<float>(3000), lengths[1]);
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<float>(7), lengths[4]);
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<float>(0.0125), lengths.back());
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), errors.size());
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), errors[0].row);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), errors[1].row);
+
+    std::vector<tTime<>> times;
+    RRLIB_UNIT_TESTS_ASSERT(ParseQuantityColumn(text.data(), text.size(), 0, times, errors, ',', 1));
+    RRLIB_UNIT_TESTS_EQUALITY(tTime<>(5), times.back());
+
+    RRLIB_UNIT_TESTS_ASSERT(!ParseQuantityColumn("/nonexistent/file.csv", 0, times, errors));
+    RRLIB_UNIT_TESTS_ASSERT(times.empty() && errors.size() == 1);
+
+    std::string long_number = "+0." + std::string(70, '0') + "1 m\n1e999 m\n-2.5e-3 m\n";
+    RRLIB_UNIT_TESTS_ASSERT(!ParseQuantityColumn(long_number.data(), long_number.size(), 0, lengths, errors));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), errors.size());
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("Number too long"), errors[0].message);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("Number out of range"), errors[1].message);
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<float>(-0.0025), lengths[2]);
+
+    // a decimal comma locale must not change the parsing of the decimal point
+    std::string numeric_locale = std::setlocale(LC_NUMERIC, nullptr);
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8"))
+    {
+      std::string decimal_point = "1.5 m\n";
+      bool parsed = ParseQuantityColumn(decimal_point.data(), decimal_point.size(), 0, lengths, errors);
+      std::setlocale(LC_NUMERIC, numeric_locale.c_str());
+      RRLIB_UNIT_TESTS_ASSERT(parsed);
+      RRLIB_UNIT_TESTS_EQUALITY(tLength<float>(1.5), lengths[0]);
+    }
+  }
+
+  void BufferConversion()
+  {
+    std::vector<int16_t> millimeters(200000);
+    for (size_t i = 0; i < millimeters.size(); ++i)
+    {
+      millimeters[i] = static_cast<int16_t>(i % 1000);
+    }
+    std::vector<tLength<float>> lengths(millimeters.size());
+    ConvertBuffer("mm", millimeters.data(), lengths.data(), millimeters.size(), 4);
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<float>(0), lengths[0]);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tLength<float>(0.999f), lengths[199999]));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tLength<float>(0.5f), lengths[100500]));
+
+    double speeds[] = { 3.6, 36, 72 };
+    tVelocity<> velocities[3];
+    ConvertBuffer("km/h", speeds, velocities, 3);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tVelocity<>(20), velocities[2]));
+    RRLIB_UNIT_TESTS_EXCEPTION(ConvertBuffer("kg", speeds, velocities, 3), std::runtime_error);
+  }
+
+  void AngleKernels()
+  {
+    const size_t count = 1001;
+    std::vector<math::tAngle<double, math::angle::Radian, math::angle::NoWrap>> angles(count);
+    std::vector<math::tAngle<float, math::angle::Radian, math::angle::NoWrap>> float_angles(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      angles[i] = -1E4 + 20.0 * i + 0.1 * i;
+      float_angles[i] = static_cast<float>(angles[i]);
+    }
+    std::vector<double> sines(count), cosines(count);
+    std::vector<float> float_sines(count), float_cosines(count);
+    SinCos(angles.data(), sines.data(), cosines.data(), count);
+    SinCos(float_angles.data(), float_sines.data(), float_cosines.data(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(sines[i] - std::sin(angles[i])) < 5E-15 && std::fabs(cosines[i] - std::cos(angles[i])) < 5E-15);
+      double x = static_cast<float>(float_angles[i]);
+      RRLIB_UNIT_TESTS_ASSERT(std::fabs(float_sines[i] - std::sin(x)) < 2E-6 && std::fabs(float_cosines[i] - std::cos(x)) < 2E-6);
+    }
+
+    math::tAngle<float, math::angle::Radian, math::angle::NoWrap> special_angles[] = { std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+    float special_sines[3], special_cosines[3];
+    SinCos(special_angles, special_sines, special_cosines, 3);
+    for (size_t i = 0; i < 3; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::isnan(special_sines[i]) && std::isnan(special_cosines[i]));
+    }
+
+    std::vector<math::tAngle<double, math::angle::Radian, math::angle::Signed>> signed_angles(count);
+    std::vector<math::tAngle<double, math::angle::Radian, math::angle::Unsigned>> unsigned_angles(count);
+    Wrap(angles.data(), signed_angles.data(), count);
+    Wrap(angles.data(), unsigned_angles.data(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(signed_angles[i] >= -M_PI && signed_angles[i] < M_PI && std::fabs(std::sin(signed_angles[i]) - std::sin(angles[i])) < 1E-9);
+      RRLIB_UNIT_TESTS_ASSERT(unsigned_angles[i] >= 0 && unsigned_angles[i] < 2 * M_PI && std::fabs(std::cos(unsigned_angles[i]) - std::cos(angles[i])) < 1E-9);
+    }
+
+    math::tAngle<double, math::angle::Degree, math::angle::NoWrap> degrees[] = { 540, -90 };
+    math::tAngle<double, math::angle::Degree, math::angle::Signed> wrapped_degrees[2];
+    Wrap(degrees, wrapped_degrees, 2);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(-180.0, static_cast<double>(wrapped_degrees[0]), 1E-12);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(-90.0, static_cast<double>(wrapped_degrees[1]), 1E-12);
+
+    tAngularVelocity<double, math::angle::Degree> degree_velocities[] = { tAngularVelocity<double, math::angle::Degree>(180) };
+    tAngularVelocity<double, math::angle::Radian> radian_velocities[1];
+    ConvertAngles(degree_velocities, radian_velocities, 1);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(M_PI, static_cast<double>(radian_velocities[0].Value()), 1E-12);
+  }
+
+  void QuantityMath()
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(2), Abs(tLength<>(-2)));
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(-2), Min(tLength<>(-2), tLength<>(3)));
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(3), Max(tLength<>(-2), tLength<>(3)));
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(1), Clamp(tLength<>(5), tLength<>(-1), tLength<>(1)));
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(-1), Clamp(tLength<>(-5), tLength<>(-1), tLength<>(1)));
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(0.5), Clamp(tLength<>(0.5), tLength<>(-1), tLength<>(1)));
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(5), Hypot(tLength<>(3), tLength<>(4)));
+
+    tLength<> position = Fma(tVelocity<>(2), tTime<>(0.5), tLength<>(1));
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(2), position);
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(7), Fma(tLength<>(3), 2.0, tLength<>(1)));
+    // single rounding: (1 + e) * (1 - e) - 1 is -e^2 instead of 0
+    const double epsilon = std::ldexp(1.0, -30);
+    RRLIB_UNIT_TESTS_EQUALITY(tEnergy<>(-epsilon * epsilon), Fma(tForce<>(1 + epsilon), tLength<>(1 - epsilon), tEnergy<>(-1)));
+
+    tVelocity<> velocities[] = { tVelocity<>(1), tVelocity<>(-2), tVelocity<>(3) };
+    tLength<> positions[] = { tLength<>(0), tLength<>(0), tLength<>(1) };
+    Fma(velocities, tTime<>(0.1), positions, positions, 3);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tLength<>(-0.2), positions[1]) && IsEqual(tLength<>(1.3), positions[2]));
+    Clamp(velocities, tVelocity<>(-1), tVelocity<>(1), velocities, 3);
+    RRLIB_UNIT_TESTS_EQUALITY(tVelocity<>(-1), velocities[1]);
+    Abs(velocities, velocities, 3);
+    RRLIB_UNIT_TESTS_EQUALITY(tVelocity<>(1), velocities[1]);
+  }
+
+  void ControlBlocks()
+  {
+    const tTime<> dt(0.001);
+    const tAcceleration<> accelerations[] = { tAcceleration<>(1), tAcceleration<>(-2) };
+
+    tEulerIntegrator<tAcceleration<>::tUnit, 2> euler;
+    static_assert(std::is_same<decltype(euler)::tOutput, tVelocity<>>::value, "Integrating an acceleration must yield a velocity");
+    tSemiImplicitEulerIntegrator<tAcceleration<>::tUnit, 2> semi_implicit_euler;
+    static_assert(std::is_same<decltype(semi_implicit_euler)::tOutput, tLength<>>::value, "Integrating an acceleration twice must yield a length");
+    for (int i = 0; i < 1000; ++i)
+    {
+      euler.Update(accelerations, dt);
+      semi_implicit_euler.Update(accelerations, dt);
+    }
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tVelocity<>(1), euler.State()[0], 1E-9) && IsEqual(tVelocity<>(-2), euler.State()[1], 1E-9));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tLength<>(-1), semi_implicit_euler.State()[1], 1E-2));
+
+    // d(x)/dt = -x / tau
+    const tTime<> tau(0.5);
+    tRK4Integrator<tMeter, 1> rk4(tLength<>(1));
+    tTime<> t;
+    for (int i = 0; i < 100; ++i, t += tTime<>(0.01))
+    {
+      rk4.Update([tau](tTime<>, const tLength<> *x, tVelocity<> *derivative)
+      {
+        derivative[0] = -x[0] / tau;
+      }, t, tTime<>(0.01));
+    }
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tLength<>(std::exp(-2.0)), rk4.State()[0], 1E-9));
+
+    tLength<> step[] = { tLength<>(1), tLength<>(2), tLength<>(3) };
+    tLength<> filtered[3];
+    auto first_order = tFirstOrderFilter<tMeter, 3>::LowPass(tFrequency<>(10), dt);
+    auto second_order = tSecondOrderFilter<tMeter, 3>::LowPass(tFrequency<>(10), dt);
+    first_order.Update(step, filtered);
+    RRLIB_UNIT_TESTS_ASSERT(filtered[2] < tLength<>(0.2));
+    second_order.Update(step, filtered);
+    RRLIB_UNIT_TESTS_ASSERT(filtered[2] < tLength<>(0.01));
+    for (int i = 0; i < 2000; ++i)
+    {
+      first_order.Update(step, filtered);
+      second_order.Update(step, filtered);
+    }
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tLength<>(3), filtered[2], 1E-6));
+    second_order.Reset(tLength<>(5));
+    second_order.Update(step, filtered);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tLength<>(5), filtered[0], 1E-2));
+
+    tDerivative<tMeter, 3> derivative;
+    tVelocity<> velocities[3];
+    derivative.Update(step, dt, velocities);
+    RRLIB_UNIT_TESTS_EQUALITY(tVelocity<>(0), velocities[0]);
+    step[1] = tLength<>(2.001);
+    derivative.Update(step, dt, velocities);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tVelocity<>(1), velocities[1], 1E-6) && IsEqual(tVelocity<>(0), velocities[2]));
+  }
+
+  void QuantityFrames()
+  {
+    struct tStamp : tField<tTime<>>
+    {
+      static const char *Name()
+      {
+        return "stamp";
+      }
+    };
+    struct tPosition : tField<tLength<float>>
+    {
+      static const char *Name()
+      {
+        return "position";
+      }
+    };
+    struct tLoad : tField<tForce<>>
+    {
+      static const char *Name()
+      {
+        return "load";
+      }
+    };
+
+    tQuantityFrame<tStamp, tPosition, tLoad> frames;
+    frames.Append(tTime<>(0), tLength<float>(1), tForce<>(10));
+    frames.Append(tTime<>(0.1), tLength<float>(2), tForce<>(20));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), frames.Size());
+    static_assert(std::is_same<decltype(frames.Column<tPosition>()), std::vector<tLength<float>>&>::value, "Columns must be typed");
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<float>(2), frames.Column<tPosition>()[1]);
+    frames[1].Get<tLoad>() = tForce<>(25);
+    RRLIB_UNIT_TESTS_EQUALITY(tForce<>(25), frames.Column<tLoad>()[1]);
+    const auto &const_frames = frames;
+    RRLIB_UNIT_TESTS_EQUALITY(tTime<>(0.1), const_frames[1].Get<tStamp>());
+
+    serialization::tMemoryBuffer memory_buffer;
+    serialization::tOutputStream output_stream(memory_buffer);
+    serialization::tInputStream input_stream(memory_buffer);
+    output_stream << frames;
+    WriteColumn<tLoad>(output_stream, frames);
+    output_stream.Flush();
+
+    tQuantityFrame<tStamp, tPosition, tLoad> read_frames;
+    input_stream >> read_frames;
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), read_frames.Size());
+    RRLIB_UNIT_TESTS_ASSERT(frames.Column<tPosition>() == read_frames.Column<tPosition>() && frames.Column<tLoad>() == read_frames.Column<tLoad>());
+    RRLIB_UNIT_TESTS_EXCEPTION(ReadColumn<tStamp>(input_stream, read_frames), std::runtime_error);
+  }
+
+  void TimeSeriesFiles()
+  {
+    const std::string file_name = std::string(P_tmpdir) + "/rrlib_si_units_test_time_series";
+    std::remove(file_name.c_str());
+    typedef tTimeSeriesWriter<tForce<float>>::tTimestamp tTimestamp;
+    {
+      tTimeSeriesWriter<tForce<float>> writer(file_name, 16);
+      for (int i = 0; i < 40; ++i)
+      {
+        writer.Append(tTimestamp(std::chrono::milliseconds(i)), tForce<float>(i));
+      }
+    }
+    {
+      tTimeSeriesWriter<tForce<float>> writer(file_name);
+      RRLIB_UNIT_TESTS_EQUALITY(uint64_t(40), writer.NumberOfSamples());
+      writer.Append(tTimestamp(std::chrono::milliseconds(40)), tForce<float>(40));
+    }
+    RRLIB_UNIT_TESTS_EXCEPTION(tTimeSeriesWriter<tLength<float>> wrong_unit(file_name), std::runtime_error);
+
+    tTimeSeriesReader<tForce<float>> reader(file_name);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), reader.NumberOfBlocks());
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(41), reader.NumberOfSamples());
+    auto block = reader.Block(2);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(9), block.size);
+    RRLIB_UNIT_TESTS_EQUALITY(tForce<float>(40), block.values[8]);
+    RRLIB_UNIT_TESTS_ASSERT(block.timestamps[8].TimeSinceEpoch() == std::chrono::milliseconds(40));
+    RRLIB_UNIT_TESTS_ASSERT(reinterpret_cast<uintptr_t>(block.values) % 64 == 0);
+    RRLIB_UNIT_TESTS_EQUALITY(tForce<float>(17), reader.Block(1).values[1]);
+
+    RRLIB_UNIT_TESTS_EXCEPTION(tTimeSeriesReader<tForce<double>> wrong_value_type(file_name), std::runtime_error);
+    std::remove(file_name.c_str());
+  }
+
+  void ScopedSymbolContexts()
+  {
+    auto to_string = [](tEnergy<> energy)
+    {
+      std::stringstream stream;
+      stream << energy;
+      return stream.str();
+    };
+    int exponents[] = { 2, 1, -2, 0, 0, 0, 0 };
+
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("1 Nm"), to_string(tEnergy<>(1)));
+    {
+      tScopedSymbolContext context(tJoule(), "J");
+      RRLIB_UNIT_TESTS_EQUALITY(std::string("1 J"), to_string(tEnergy<>(1)));
+      RRLIB_UNIT_TESTS_EQUALITY(std::string("J"), SymbolFromExponentList(exponents));
+      {
+        tScopedSymbolContext inner_context;
+        inner_context.Add(tJoule(), "Ws");
+        RRLIB_UNIT_TESTS_EQUALITY(std::string("1 Ws"), to_string(tEnergy<>(1)));
+      }
+      RRLIB_UNIT_TESTS_EQUALITY(std::string("1 J"), to_string(tEnergy<>(1)));
+
+      std::string other_thread_output;
+      std::thread other_thread([&]()
+      {
+        other_thread_output = to_string(tEnergy<>(1));
+      });
+      other_thread.join();
+      RRLIB_UNIT_TESTS_EQUALITY(std::string("1 Nm"), other_thread_output);
+
+      std::stringstream stream;
+      stream << UseSymbol(tJoule(), "Ws", false) << tEnergy<>(1) << ", " << tEnergy<>(1);
+      RRLIB_UNIT_TESTS_EQUALITY(std::string("1 Ws, 1 J"), stream.str());
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("1 Nm"), to_string(tEnergy<>(1)));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("Nm"), SymbolFromExponentList(exponents));
+  }
+
+  void SimdValues()
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(2.5, (tLength<int>(5) / 2).Value());
+    RRLIB_UNIT_TESTS_EQUALITY(0.5, (1 / tLength<int>(2)).Value());
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(1), Select(tLength<>(2) > tLength<>(1), tLength<>(1), tLength<>(2)));
+
+#ifdef __GNUC__
+    typedef float tFloat4 __attribute__((vector_size(16)));
+    typedef tQuantity<tMeter, tFloat4> tLength4;
+    const tFloat4 a_values = { 1, 2, 3, 4 };
+    const tFloat4 b_values = { 4, 3, 2, 1 };
+    const tLength4 a(a_values), b(b_values);
+    RRLIB_UNIT_TESTS_EQUALITY(0.0f, tLength4().Value()[3]);
+
+    const tQuantity<tSIUnit<2, 0, 0, 0, 0, 0, 0>, tFloat4> area = a * b;
+    RRLIB_UNIT_TESTS_EQUALITY(6.0f, area.Value()[2]);
+    const tQuantity<tSIUnit<1, 0, -1, 0, 0, 0, 0>, tFloat4> velocity = a / tTime<float>(2);
+    RRLIB_UNIT_TESTS_EQUALITY(2.0f, velocity.Value()[3]);
+    RRLIB_UNIT_TESTS_EQUALITY(0.5f, (a / 2.0f).Value()[0]);
+
+    auto mask = a < b;
+    RRLIB_UNIT_TESTS_ASSERT(mask[0] && mask[1] && !mask[2] && !mask[3]);
+    const tLength4 minimum = Select(mask, a, b);
+    RRLIB_UNIT_TESTS_ASSERT(minimum.Value()[0] == 1 && minimum.Value()[1] == 2 && minimum.Value()[2] == 2 && minimum.Value()[3] == 1);
+    const tLength4 maximum = Max(a, b);
+    RRLIB_UNIT_TESTS_ASSERT(maximum.Value()[0] == 4 && maximum.Value()[3] == 4);
+    RRLIB_UNIT_TESTS_EQUALITY(2.0f, Abs(-a).Value()[1]);
+
+    auto equal = IsEqual(a, tLength4(a_values + 1E-7f));
+    RRLIB_UNIT_TESTS_ASSERT(equal[0] && equal[1] && equal[2] && equal[3]);
+    auto not_equal = IsEqual(a, b);
+    RRLIB_UNIT_TESTS_ASSERT(!not_equal[0] && !not_equal[3]);
+#endif
+
+#ifdef RRLIB_SI_UNITS_TEST_EXPERIMENTAL_SIMD
+    typedef std::experimental::native_simd<float> tSimd;
+    const tQuantity<tMeter, tSimd> x(tSimd([](int i)
+    {
+      return float(i);
+    })), y(tSimd(1.0f));
+    const auto x_greater = x > y;
+    RRLIB_UNIT_TESTS_EQUALITY(int(tSimd::size()) - 2, std::experimental::popcount(x_greater));
+    const tQuantity<tMeter, tSimd> clamped = Select(x_greater, y, x);
+    RRLIB_UNIT_TESTS_ASSERT(std::experimental::all_of(clamped.Value() <= 1.0f));
+    RRLIB_UNIT_TESTS_ASSERT(std::experimental::all_of(IsEqual(Min(x, y), clamped)));
+#endif
+  }
+
+  void Reductions()
+  {
+    std::vector<tForce<>> forces(300001);
+    for (size_t i = 0; i < forces.size(); ++i)
+    {
+      forces[i] = tForce<>((i % 2) ? 3.0 : -3.0);
+    }
+    forces[123457] = tForce<>(10);
+
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tForce<>(4), Sum(forces.data(), forces.size(), 4)));
+    RRLIB_UNIT_TESTS_EQUALITY(Sum(forces.data(), forces.size(), 1), Sum(forces.data(), forces.size(), 4));
+    RRLIB_UNIT_TESTS_EQUALITY(tForce<>(10), Maximum(forces.data(), forces.size(), 4));
+    RRLIB_UNIT_TESTS_EQUALITY(tForce<>(-3), Minimum(forces.data(), forces.size()));
+    tQuantity<operators::tProduct<tNewton, tNewton>::tResult> sum_of_squares = SumOfSquares(forces.data(), forces.size(), 4);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuantity<operators::tProduct<tNewton, tNewton>::tResult>(300000 * 9.0 + 100), sum_of_squares, 1E-6));
+    tForce<> rms = RMS(forces.data(), 3);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tForce<>(3), rms));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tForce<>(-1), Mean(forces.data(), 3)));
+
+    std::vector<tLength<int32_t>> lengths = { tLength<int32_t>(2000000000), tLength<int32_t>(2000000000), tLength<int32_t>(-2000000000) };
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<int32_t>(2000000000), Sum(lengths.data(), lengths.size()));
+
+    std::vector<uint64_t> mask(BitmaskSize(forces.size()));
+    GreaterMask(forces.data(), forces.size(), tForce<>(5), mask.data(), 4);
+    RRLIB_UNIT_TESTS_ASSERT(BitmaskTest(mask.data(), 123457) && !BitmaskTest(mask.data(), 123456) && !BitmaskTest(mask.data(), 300000));
+    RRLIB_UNIT_TESTS_ASSERT(AnyGreater(forces.data(), forces.size(), tForce<>(5), 4) && !AnyGreater(forces.data(), forces.size(), tForce<>(10), 4));
+    LessMask(forces.data(), 3, tForce<>(0), mask.data());
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(5), mask[0]);
+
+    std::vector<tForce<>> shifted(forces.begin(), forces.begin() + 100);
+    shifted[70] += tForce<>(1);
+    IsEqualMask(forces.data(), shifted.data(), shifted.size(), mask.data(), 0.5);
+    RRLIB_UNIT_TESTS_EQUALITY(~uint64_t(0), mask[0]);
+    RRLIB_UNIT_TESTS_EQUALITY((uint64_t(1) << 36) - 1 - (uint64_t(1) << 6), mask[1]);
+  }
+
+  void QuantityStatistics()
+  {
+    std::vector<tElectricCurrent<>> currents;
+    for (int i = 0; i < 1000; ++i)
+    {
+      currents.push_back(tElectricCurrent<>(1E6 + (i % 10)));
+    }
+
+    tQuantityStatistics<tAmpere> single;
+    for (auto & current : currents)
+    {
+      single.Update(current);
+    }
+    static_assert(std::is_same<decltype(single.Variance()), tQuantity<tSIUnit<0, 0, 0, 2, 0, 0, 0>>>::value, "Variance must have the squared unit");
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(1000), single.Count());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tElectricCurrent<>(1E6 + 4.5), single.Mean(), 1E-9));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuantity<tSIUnit<0, 0, 0, 2, 0, 0, 0>>(8.25), single.Variance(), 1E-6));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tElectricCurrent<>(std::sqrt(8.25)), single.StandardDeviation(), 1E-6));
+    RRLIB_UNIT_TESTS_EQUALITY(tElectricCurrent<>(1E6), single.Minimum());
+    RRLIB_UNIT_TESTS_EQUALITY(tElectricCurrent<>(1E6 + 9), single.Maximum());
+
+    tQuantityStatistics<tAmpere> first, second;
+    first.Update(currents.data(), 333);
+    second.Update(currents.data() + 333, currents.size() - 333);
+    first.Merge(second);
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(1000), first.Count());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(single.Mean(), first.Mean(), 1E-9));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(single.Variance(), first.Variance(), 1E-6));
+    RRLIB_UNIT_TESTS_EQUALITY(single.Minimum(), first.Minimum());
+    RRLIB_UNIT_TESTS_EQUALITY(single.Maximum(), first.Maximum());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuantity<tSIUnit<0, 0, 0, 2, 0, 0, 0>>(8.25 * 1000 / 999), first.SampleVariance(), 1E-6));
+  }
+
+  void RingBuffers()
+  {
+    tRingBuffer<tLength<>, 8> buffer;
+    tLength<> value;
+    RRLIB_UNIT_TESTS_ASSERT(!buffer.Pop(value));
+    for (int i = 0; i < 8; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(buffer.Push(tLength<>(i)));
+    }
+    RRLIB_UNIT_TESTS_ASSERT(!buffer.Push(tLength<>(8)));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(8), buffer.Size());
+
+    tLength<> values[8];
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(5), buffer.Pop(values, 5));
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(4), values[4]);
+    const tLength<> more[] = { tLength<>(8), tLength<>(9), tLength<>(10), tLength<>(11), tLength<>(12), tLength<>(13) };
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(5), buffer.Push(more, 6));
+
+    auto readable = buffer.ReadableSpan();
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), readable.size);
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(5), readable.data[0]);
+    buffer.Release(readable.size);
+    readable = buffer.ReadableSpan();
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(5), readable.size);
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(12), readable.data[4]);
+    buffer.Release(readable.size);
+    RRLIB_UNIT_TESTS_ASSERT(buffer.Empty());
+
+    auto writable = buffer.WritableSpan();
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), writable.size);
+    writable.data[0] = tLength<>(42);
+    buffer.Commit(1);
+    RRLIB_UNIT_TESTS_ASSERT(buffer.Pop(value));
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(42), value);
+
+    struct tStamp : tField<tTime<>> {};
+    struct tForceX : tField<tForce<>> {};
+    typedef tQuantityFrame<tStamp, tForceX> tFrame;
+    tRingBuffer<tFrame::tRecord, 1024> records;
+    const size_t cCOUNT = 100000;
+    std::thread producer([&records, cCOUNT]()
+    {
+      for (size_t i = 0; i < cCOUNT;)
+      {
+        i += records.Push(tFrame::tRecord(tTime<>(i), tForce<>(2.0 * i))) ? 1 : 0;
+      }
+    });
+    tFrame frame;
+    frame.Reserve(cCOUNT);
+    while (frame.Size() < cCOUNT)
+    {
+      auto span = records.ReadableSpan();
+      for (size_t i = 0; i < span.size; ++i)
+      {
+        frame.Append(span.data[i]);
+      }
+      records.Release(span.size);
+    }
+    producer.join();
+    bool in_order = true;
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      in_order &= frame[i].Get<tStamp>() == tTime<>(i) && frame[i].Get<tForceX>() == tForce<>(2.0 * i);
+    }
+    RRLIB_UNIT_TESTS_ASSERT(in_order);
+    RRLIB_UNIT_TESTS_ASSERT(std::get<1>(frame.Record(3)) == tForce<>(6));
+  }
+
+  void QuantityOperations()
+  {
+    RRLIB_UNIT_TESTS_ASSERT(GetQuantityOperations(rtti::tDataType<int>()) == nullptr);
+    const tQuantityOperations *operations = GetQuantityOperations(rtti::tDataType<tLength<float>>());
+    RRLIB_UNIT_TESTS_ASSERT(operations != nullptr);
+    RRLIB_UNIT_TESTS_ASSERT(operations == &tQuantityOperations::Get<tLength<float>>());
+    RRLIB_UNIT_TESTS_ASSERT(operations->dimension == tDimension(tMeter()));
+    RRLIB_UNIT_TESTS_EQUALITY(sizeof(float), operations->value_size);
+
+    const tLength<float> lengths[] = { tLength<float>(0.125f), tLength<float>(-2.5f), tLength<float>(1234.5f) };
+    double doubles[3];
+    operations->to_double(lengths, doubles, 3);
+    RRLIB_UNIT_TESTS_EQUALITY(0.125, doubles[0]);
+    RRLIB_UNIT_TESTS_EQUALITY(1234.5, doubles[2]);
+
+    std::string text;
+    operations->format(lengths, 3, text, ';');
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("0.125 m;-2.5 m;1234.5 m"), text);
+    tLength<float> parsed[3];
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), operations->parse(text.data(), text.size(), parsed, 3, ';'));
+    RRLIB_UNIT_TESTS_ASSERT(std::equal(lengths, lengths + 3, parsed));
+
+    const std::string lines = "12.5 mm\n3 km\nfoo\n";
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), operations->parse(lines.data(), lines.size(), parsed, 3, ','));
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<float>(0.0125f), parsed[0]);
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<float>(3000), parsed[1]);
+
+    const tLength<int> integer_lengths[] = { tLength<int>(123), tLength<int>(-7) };
+    text.clear();
+    tQuantityOperations::Get<tLength<int>>().format(integer_lengths, 2, text, ';');
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("123 m;-7 m"), text);
+    const tTime<uint64_t> long_times[] = { tTime<uint64_t>(18446744073709551615ull) };
+    text.clear();
+    tQuantityOperations::Get<tTime<uint64_t>>().format(long_times, 1, text, ';');
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("18446744073709551615 s"), text);
+
+    const tQuantityOperations *angular = GetQuantityOperations(rtti::tDataType<tAngularVelocity<double, math::angle::Degree>>());
+    RRLIB_UNIT_TESTS_ASSERT(angular != nullptr && angular->dimension == tDimension(tHertz()));
+    const tAngularVelocity<double, math::angle::Degree> rates[] = { tAngularVelocity<double, math::angle::Degree>(90) };
+    angular->to_double(rates, doubles, 1);
+    RRLIB_UNIT_TESTS_EQUALITY(90.0, doubles[0]);
+  }
+
+  struct tWriterStamp : tField<tTime<>>
+  {
+    static const char *Name()
+    {
+      return "stamp";
+    }
+  };
+  struct tWriterForce : tField<tForce<float>>
+  {
+    static const char *Name()
+    {
+      return "force";
+    }
+  };
+  struct tWriterRatio : tField<tQuantity<tNoUnit>>
+  {
+    static const char *Name()
+    {
+      return "ratio";
+    }
+  };
+
+  void ColumnWriter()
+  {
+    tQuantityFrame<tWriterStamp, tWriterForce, tWriterRatio> frame;
+    frame.Append(tTime<>(0.5), tForce<float>(-2.25f), tQuantity<tNoUnit>(3));
+    frame.Append(tTime<>(1), tForce<float>(1E3f), tQuantity<tNoUnit>(0));
+    std::stringstream text;
+    WriteQuantityFrame(text, frame, ';');
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("stamp [s];force [N];ratio\n0.5;-2.25;3\n1;1000;0\n"), text.str());
+
+    std::vector<tLength<>> lengths;
+    for (size_t i = 0; i < 3 * cMINIMUM_PARALLEL_WRITE_SIZE + 5; ++i)
+    {
+      lengths.push_back(tLength<>(0.001 * i + 0.1));
+    }
+    std::stringstream column;
+    WriteQuantityColumn(column, "x", lengths.data(), lengths.size(), 4);
+    const std::string output = column.str();
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("x [m]\n"), output.substr(0, 6));
+
+    std::vector<tLength<>> parsed;
+    std::vector<tParseError> errors;
+    RRLIB_UNIT_TESTS_ASSERT(ParseQuantityColumn(output.data(), output.size(), 0, parsed, errors, ',', 1));
+    RRLIB_UNIT_TESTS_ASSERT(parsed == lengths);
+  }
+
+  void Literals()
+  {
+    using namespace si_units::literals;
+
+    constexpr tLength<> length = 5_mm;
+    static_assert(length.Value() == 5 * cMILLI, "Literals must be evaluated at compile time");
+    static_assert(std::is_same<decltype(10_kN), tForce<>>::value, "10_kN must be a force");
+    static_assert((250_us).Value() == 250 * cMICRO, "Integer literals must be scaled");
+    static_assert((1.5_h).Value() == 5400, "Hours must be converted to seconds");
+
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(0.005), length);
+    RRLIB_UNIT_TESTS_EQUALITY(tForce<>(10000), 10_kN);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tVelocity<>(1), 3.6_km_h, 1E-12));
+    RRLIB_UNIT_TESTS_EQUALITY(tPressure<>(2E5), 2_bar);
+    RRLIB_UNIT_TESTS_EQUALITY(tVelocity<>(2), 4_m / 2_s);
+  }
+
+  void EngineeringNotationOutput()
+  {
+    std::stringstream stream;
+    stream << EngineeringNotation << tLength<>(0.000005) << "; " << tFrequency<>(3E6) << "; " << tMass<>(0.002) << "; " << tMass<>(1500) << "; " << tLength<>(0);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("5 µm; 3 MHz; 2 g; 1.5 Mg; 0 m"), stream.str());
+
+    stream.str("");
+    stream << tLength<>(999999.9) << "; " << tVelocity<>(-25000) << "; " << tLength<>(1E30);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("1 Mm; -25 km/s; 1e+06 Ym"), stream.str());
+
+    stream.str("");
+    stream << BaseUnitNotation << tLength<>(0.5);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("0.5 m"), stream.str());
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("4.7 kΩ"), FormatEngineeringNotation(tResistance<>(4700)));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("1500 Nm"), FormatEngineeringNotation(tForce<>(1500) * tLength<>(1)));
+
+    const tLength<> lengths[] = { tLength<>(1.234567890123E-7), tLength<>(42), tLength<>(-6.02E23) };
+    for (auto & length : lengths)
+    {
+      const std::string text = FormatEngineeringNotation(length, 17);
+      const size_t separator = text.find(' ');
+      const tLength<> parsed(std::stod(text.substr(0, separator)) * GetCachedFactorToBaseUnit<tMeter>(text.substr(separator + 1)));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(length, parsed, 1E-15));
+    }
+  }
+
+  void OperationCounters()
+  {
+    ResetOperationCounts();
+    std::thread worker([]()
+    {
+      for (int i = 0; i < 1000; ++i)
+      {
+        internal::CountOperation<tNewton, tMeter>(eAO_DIVIDE);
+      }
+    });
+    for (int i = 0; i < 500; ++i)
+    {
+      internal::CountOperation<tNewton, tMeter>(eAO_DIVIDE);
+      internal::CountOperation<tMeter, tNoUnit>(eAO_MULTIPLY);
+    }
+    worker.join();
+    internal::CountOperation<tMeter, tMeter>(eAO_ADD);
+
+    std::vector<tOperationCount> counts = GetOperationCounts();
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), counts.size());
+    RRLIB_UNIT_TESTS_EQUALITY(eAO_DIVIDE, counts[0].operation);
+    RRLIB_UNIT_TESTS_ASSERT(counts[0].left == tDimension(tNewton()) && counts[0].right == tDimension(tMeter()));
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(1500), counts[0].count);
+
+    std::stringstream dump;
+    DumpOperationCounts(dump);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("N / m: 1500\nm * 1: 500\nm + m: 1\n"), dump.str());
+
+    ResetOperationCounts();
+    RRLIB_UNIT_TESTS_ASSERT(GetOperationCounts().empty());
+
+#ifndef RRLIB_SI_UNITS_COUNT_OPERATIONS
+    RRLIB_UNIT_TESTS_EQUALITY(tForce<>(2) / tLength<>(1), tForce<>(2) / tLength<>(1));
+    RRLIB_UNIT_TESTS_ASSERT(GetOperationCounts().empty());
+#endif
+  }
+
+#if __cplusplus >= 202002L && defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+  void CompileTimeSymbols()
+  {
+    static_assert(std::is_same<tUnitOf<"kg*m/s^2">, tNewton>::value, "kg*m/s^2 must be newton");
+    static_assert(std::is_same<tUnitOf<"N/mm^2">, tPascal>::value, "N/mm^2 must be pascal");
+    static_assert(std::is_same<tUnitOf<"m/s/s">, tUnitOf<"m*s^-2">>::value, "'/' must only apply to the following symbol");
+    static_assert(std::is_same<tUnitOf<"1/min">, tHertz>::value, "1/min must be a frequency");
+    static_assert(std::is_same<tUnitOf<"mol">, tMole>::value && std::is_same<tUnitOf<"cd">, tCandela>::value, "Exact symbols take precedence over prefixes");
+    static_assert(std::is_same<tQuantityOf<"kW*h", float>, tEnergy<float>>::value, "kW*h must be an energy");
+    static_assert(cFACTOR_OF<"N/mm^2"> == 1E6, "Prefixes must be raised to the exponent");
+    static_assert(cFACTOR_OF<"min"> == 60 && cFACTOR_OF<"hPa"> == 100 && cFACTOR_OF<"kg"> == 1, "Unexpected scale factor");
+
+    constexpr tVelocity<> velocity = QuantityFrom<"km/h">(36.0);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tVelocity<>(10), velocity, 1E-12));
+    RRLIB_UNIT_TESTS_EQUALITY(GetCachedFactorToBaseUnit<tLength<>::tUnit>("mm"), cFACTOR_OF<"mm">);
+  }
+#endif
+
+  void DynamicQuantities()
+  {
+    RRLIB_UNIT_TESTS_ASSERT(tDimension(tNewton()) == tDimension(tKilogram()) * tDimension(tAcceleration<>::tUnit()));
+    RRLIB_UNIT_TESTS_ASSERT(tDimension(tPascal()) == tDimension(tNewton()) / tDimension(tMeter()) / tDimension(tMeter()));
+    RRLIB_UNIT_TESTS_ASSERT(tDimension(tHertz()) == tDimension() / tDimension(tSecond()));
+    RRLIB_UNIT_TESTS_EQUALITY(-2, tDimension(tNewton()).Exponent(2));
+
+    tDynamicQuantity length = tLength<>(10);
+    tDynamicQuantity time = tTime<float>(2);
+    tDynamicQuantity velocity = length / time;
+    RRLIB_UNIT_TESTS_EQUALITY(tVelocity<>(5), velocity.To<tVelocity<>>());
+    RRLIB_UNIT_TESTS_EQUALITY(tLength<>(20), (length + length).To<tLength<>>());
+    RRLIB_UNIT_TESTS_EXCEPTION(length + time, std::runtime_error);
+    RRLIB_UNIT_TESTS_EXCEPTION(velocity.To<tLength<>>(), std::runtime_error);
+
+    std::stringstream stream;
+    stream << tDynamicQuantity(tForce<>(1) * tLength<>(1)) << ", " << 1 / time;
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("1 Nm, 0.5 1/s"), stream.str());
   }
 };
 